@@ -56,10 +56,27 @@
 #include "br.h"
 #include "br_cmd.h"
 #include "br_cmd_engine.h"
+#include "br_ipc.h"
+#include "br_backend.h"
+#include "br_plan.h"
+#include "br_decode.h"
+#include "br_state.h"
+#include "br_async.h"
+#include "br_profile.h"
+
+#define STREAM_DEPTH    16      /* lists on their way at once (-I, -k) */
+#define MAX_LINE_LEN    1024
+#define MAX_LINE_ARGS   64
+
+typedef struct stream_sink stream_sink;
 
 int Verbose = 0;
+int Recalibrate = 0;
 char *MyName;
 void (*saved_br_error_handler)(char *, char *);
+stream_sink *Sink = NULL;            /* what's streaming, if anything */
+
+int sink_drain(stream_sink *);
 
 void usage()
 {
@@ -79,10 +96,52 @@ void usage()
     fprintf(stderr, "  -F, --OFF\t\t\tturn off all devices in housecode\n");
     fprintf(stderr, "  -d, --dim=LEVEL[,LIST]\tdim devices in housecode to "
       " relative LEVEL\n");
+    fprintf(stderr, "  -d, --dim==LEVEL,LIST\t\tdim devices in LIST to "
+      "LEVEL (0 to %d)\n", DIMRANGE);
+    fprintf(stderr, "  -Z, --recalibrate\t\tdon't trust recorded dim levels "
+      "for -d =LEVEL\n");
     fprintf(stderr, "  -B, --lamps_on\t\tturn all lamps in housecode on\n");
     fprintf(stderr, "  -D, --lamps_off\t\tturn all lamps in housecode off\n");
     fprintf(stderr, "  -r, --repeat=NUM\t\trepeat commands NUM times "
       "(0 = ~ forever)\n");
+    fprintf(stderr, "  -b, --back-to-back\t\tsend commands without "
+      "releasing the lines in between\n");
+    fprintf(stderr, "  -g, --gap=USEC\t\tgap between back-to-back "
+      "commands\n");
+    fprintf(stderr, "  -t, --copies=SPEC\t\tsend each command more than "
+      "once: NUM, \"default\"\n\t\t\t\tor CMD=NUM,...\n");
+    fprintf(stderr, "  -u, --spread=FRAMES\t\tlet each copy fall up to "
+      "FRAMES frames behind\n");
+    fprintf(stderr, "  -P, --priority=CLASS\t\temergency, interactive "
+      "(default) or bulk, for brd\n");
+    fprintf(stderr, "  -R, --realtime\t\tuse real-time priority while "
+      "sending\n");
+    fprintf(stderr, "  -C, --cpu=NUM\t\t\tin real-time mode, send from "
+      "CPU NUM\n");
+    fprintf(stderr, "  -S, --stats\t\t\tprint timing statistics when "
+      "done (implies -l)\n");
+    fprintf(stderr, "  -T, --virtual\t\t\tsimulate the port; report "
+      "airtime (implies -l)\n");
+    fprintf(stderr, "  -o, --optimize\t\tdrop commands that don't change "
+      "the end result\n");
+    fprintf(stderr, "  -l, --local\t\t\tdon't hand commands to brd, "
+      "even if it's running\n");
+    fprintf(stderr, "  -s, --suppress=SECS\t\tskip ONs and OFFs of units "
+      "already that way\n\t\t\t\tfor less than SECS seconds\n");
+    fprintf(stderr, "  -q, --status\t\t\tprint what every unit was last "
+      "told to do\n");
+    fprintf(stderr, "  -I, --stdin\t\t\tsend commands as they're read, a "
+      "line at a time\n");
+    fprintf(stderr, "  -k, --file=PATH\t\tsame, from PATH\n");
+    fprintf(stderr, "  -w, --compile=PATH\t\tsave the commands as a plan "
+      "in PATH, without sending\n");
+    fprintf(stderr, "  -y, --play=PATH\t\tsend a plan saved with -w\n");
+    fprintf(stderr, "  -L, --profile=NAME\t\tuse the timing saved in "
+      "profile NAME\n");
+    fprintf(stderr, "  -W, --sweep=NAME\t\tfind the quickest timing the "
+      "commands get through\n\t\t\t\twith, and save it as profile NAME\n");
+    fprintf(stderr, "  -M, --receiver=SPEC\t\twhat the receiver needs, "
+      "for -W: HALFBIT,HOLD,POST\n\t\t\t\t(uSec)[,MARGIN%%]\n");
     fprintf(stderr, "  -h, --help\t\t\tthis help\n\n");
 #else
     fprintf(stderr, "  -v\tverbose (add v's to increase verbosity)\n");
@@ -92,11 +151,39 @@ void usage()
     fprintf(stderr, "  -f\tturn off devices\n");
     fprintf(stderr, "  -N\tturn all devices in housecode on\n");
     fprintf(stderr, "  -F\tturn all devices in housecode off\n");
-    fprintf(stderr, "  -d\tdim devices in housecode to relative dimlevel\n");
+    fprintf(stderr, "  -d\tdim devices in housecode to relative dimlevel "
+      "(or =level)\n");
+    fprintf(stderr, "  -Z\tdon't trust recorded dim levels for -d =level\n");
     fprintf(stderr, "  -B\tturn all lamps in housecode on\n");
     fprintf(stderr, "  -D\tturn all lamps in housecode off\n");
     fprintf(stderr, "  -r\trepeat commands <repeats> times (0 basically "
       "means don't stop)\n");
+    fprintf(stderr, "  -b\tsend commands without releasing the lines in between\n");
+    fprintf(stderr, "  -g\tgap in uSec between back-to-back commands\n");
+    fprintf(stderr, "  -t\tcopies of each command: number, \"default\" or "
+      "CMD=NUM,...\n");
+    fprintf(stderr, "  -u\thow many frames each copy can fall behind\n");
+    fprintf(stderr, "  -P\tpriority for brd: emergency, interactive or bulk\n");
+    fprintf(stderr, "  -R\tuse real-time priority while sending\n");
+    fprintf(stderr, "  -C\tin real-time mode, send from this CPU\n");
+    fprintf(stderr, "  -S\tprint timing statistics when done (implies -l)\n");
+    fprintf(stderr, "  -T\tsimulate the port; report airtime (implies -l)\n");
+    fprintf(stderr, "  -o\tdrop commands that don't change the end result\n");
+    fprintf(stderr, "  -l\tdon't hand commands to brd, even if it's running\n");
+    fprintf(stderr, "  -s\tskip ONs and OFFs of units already that way for "
+      "less than <secs>\n");
+    fprintf(stderr, "  -q\tprint what every unit was last told to do\n");
+    fprintf(stderr, "  -I\tsend commands from stdin as they're read, a line "
+      "at a time\n");
+    fprintf(stderr, "  -k\tsame, from <file>\n");
+    fprintf(stderr, "  -w\tsave the commands as a plan in <file>, without "
+      "sending\n");
+    fprintf(stderr, "  -y\tsend a plan saved with -w\n");
+    fprintf(stderr, "  -L\tuse the timing saved in profile <name>\n");
+    fprintf(stderr, "  -W\tfind the quickest timing that works; save it as "
+      "profile <name>\n");
+    fprintf(stderr, "  -M\twhat the receiver needs, for -W: "
+      "halfbit,hold,post[,margin%%]\n");
     fprintf(stderr, "  -h\tthis help\n\n");
 #endif
     fprintf(stderr, "<list>\t\tis a comma separated list of devices "
@@ -149,7 +236,39 @@ int checkimmutableport(char *port_source)
     return -1;
 }
 
-int add_dimcmd(br_control_info *cinfo, br_unit_list *units, int dim_level)
+br_state *read_state()
+{
+/*
+ * The record of what units were last told, if anyone's kept one; with
+ *  none, every unit's just unknown
+ */
+
+    static br_state *state = NULL;
+    static int tried = 0;
+    void (*handler)(char *, char *);
+
+
+    /*
+     * Anything still on its way has to be on record before what's
+     *  recorded is any use
+     */
+
+    if (Sink)
+        sink_drain(Sink);
+
+    if (!tried) {
+        tried = 1;
+        handler = br_error_handler;
+        br_error_handler = NULL;
+        state = br_state_open(NULL, 0);
+        br_error_handler = handler;
+    }
+
+    return state;
+}
+
+int add_dimcmd(br_control_info *cinfo, br_unit_list *units, int dim_level,
+  int absolute)
 {
 /*
  * Turn info into stuff usable by the command engine and add it to the
@@ -163,6 +282,24 @@ int add_dimcmd(br_control_info *cinfo, br_unit_list *units, int dim_level)
     int cmd;
 
 
+    if (absolute) {
+        if (!br_get_num_units(units)) {
+            errno = EINVAL;
+            br_error("add_dimcmd", "Dimming to a level needs a list of units");
+            return -1;
+        }
+
+        while ((dev = br_get_ul_device(units, index)) != -1) {
+            house = br_get_ul_house(units, index);
+            if (br_state_add_dim(read_state(), cinfo, house, dev, dim_level,
+              Recalibrate) < 0)
+                return -1;
+            index++;
+        }
+
+        return 0;
+    }
+
     cmd = ((dim_level < 0) ? DIM:BRIGHT);
     dim_level = (dim_level < 0) ? -dim_level:dim_level;
 
@@ -208,6 +345,28 @@ int gethouse(char *house)
     return c;
 }
 
+int getpri(char *name)
+{
+/*
+ * Grab a priority class from the command line; any unambiguous start of
+ *  the name will do
+ */
+
+    static char *names[BR_NUM_PRIS] = { "emergency", "interactive", "bulk" };
+    register int i;
+
+
+    for (i = 0; i < BR_NUM_PRIS; i++) {
+        if (*name && !strncasecmp(name, names[i], strlen(name)))
+            return i;
+    }
+
+    errno = EINVAL;
+    br_error("getpri", "Priority must be emergency, interactive or bulk");
+
+    return -1;
+}
+
 int getunits(char *list, br_unit_list **units)
 {
 /*
@@ -215,6 +374,7 @@ int getunits(char *list, br_unit_list **units)
  *  the command line
  */
     char *end;
+    char msg[128];
 
 
     if (*units == NULL) {
@@ -222,12 +382,19 @@ int getunits(char *list, br_unit_list **units)
             return -1;
     }
 
-    if ((br_strtoul(list, *units, &end) < 0)
-      || (*end != '\0'))
-    {
+    if (br_strtoul(list, *units, &end) < 0) {
+        br_free_unit_list(*units);
+        *units = NULL;
+        return -1;   /* error already printed */
+    }
+
+    if (*end != '\0') {
         br_free_unit_list(*units);
         errno = EINVAL;
-        br_error("getunits", "Devices must be in the range of [1-16], housecodes [A-P]");
+        sprintf(msg, "Unexpected '%c' at character %d of \"%.20s\" "
+          "(units look like A1,3, A1-8 or B*)", *end, (int)(end - list) + 1,
+          list);
+        br_error("getunits", msg);
         *units = NULL;
         return -1;
     }
@@ -235,16 +402,19 @@ int getunits(char *list, br_unit_list **units)
     return 0;
 }
 
-int getdim(char *list, br_unit_list **units, int *dim)
+int getdim(char *list, br_unit_list **units, int *dim, int *absolute)
 {
 /*
  * Get devices that should be dimmed from the command line, and how
- *  much to dim them
+ *  much to dim them (or, with a leading '=', what to dim them to)
  */    
     
     char *end;
 
 
+    if ((*absolute = (*list == '=')))
+        list++;
+
     *dim = strtol(list, &end, 0);
 
     while (isspace(*end))
@@ -267,7 +437,8 @@ int getdim(char *list, br_unit_list **units, int *dim)
      *  dimming
      */
 
-    if ((*dim < -DIMRANGE) || (*dim > DIMRANGE))
+    if ((*dim < (*absolute ? 0:-DIMRANGE)) || (*dim > DIMRANGE)
+      || (*absolute && (end == list)))
     {
         if (*units)
             br_free_unit_list(*units);
@@ -323,11 +494,74 @@ int close_port(int fd)
     if (Verbose >= 2)
         printf("%s: Closing serial port.\n", MyName);
 
+    br_forget_lines(fd);
     close(fd);
 
     return 0;
 }
 
+int realtime(int cpu)
+{
+/*
+ * Turn on real-time mode, and tell the user if it didn't all happen
+ */
+
+    int granted;
+
+
+    granted = br_rt_enable(cpu, 0);
+
+    if (!(granted & BR_RT_SCHED) || ((cpu >= 0) && !(granted & BR_RT_AFFINITY)))
+        fprintf(stderr, "%s: warning: real-time mode only partly available "
+          "(need root or CAP_SYS_NICE)\n", MyName);
+
+    if (Verbose >= 1)
+        printf("%s: Real-time scheduling %s, memory %s, %s\n", MyName,
+          (granted & BR_RT_SCHED) ? "on":"off",
+          (granted & BR_RT_MLOCK) ? "locked":"not locked",
+          (granted & BR_RT_AFFINITY) ? "pinned to CPU":"not pinned");
+
+    return granted;
+}
+
+int daemon_execute(br_control_info *cinfo, char *sockname)
+{
+/*
+ * Hand the commands off to brd, if it's around, and wait for it to
+ *  send them.  Returns 1 if there's no daemon to talk to, so the caller
+ *  can go ahead and do it the old-fashioned way.
+ */
+
+    int sock;
+    int status;
+    int err;
+
+
+    if ((sock = br_daemon_connect(sockname)) < 0)
+        return 1;
+
+    if (Verbose >= 2)
+        printf("%s: Handing %d commands to brd on %s\n", MyName,
+          br_get_num_commands(cinfo), sockname);
+
+    if ((br_send_control_info(sock, cinfo) < 0)
+      || (br_recv_status(sock, &status, &err) < 0))
+    {
+        close(sock);
+        return -1;
+    }
+
+    close(sock);
+
+    if (status < 0) {
+        errno = err;
+        br_error("daemon_execute", "brd was unable to send commands");
+        return -1;
+    }
+
+    return 0;
+}
+
 int native_getunits(char *arg, br_unit_list **units)
 {
 /*
@@ -384,6 +618,66 @@ int native_getcmd(char *arg)
     return -1;
 }
 
+int getcopies(br_control_info *cinfo, char *spec)
+{
+/*
+ * How many copies of which commands to send: "default", a number (for
+ *  every command that can go more than once), or a list of "CMD=NUM"
+ *  with native command names
+ */
+
+    char *end;
+    char *eq;
+    int copies;
+    int cmd;
+
+
+    if (!strcasecmp(spec, "default"))
+        return br_set_default_copies(cinfo);
+
+    if (isdigit(*spec)) {
+        copies = strtol(spec, &end, 10);
+
+        if (*end)
+            goto bad;
+
+        for (cmd = ON; cmd < BR_NUM_CMDS; cmd++) {
+            if (!ISDIMCMD(cmd) && (cmd != PAUSE)
+              && (br_set_copies(cinfo, cmd, copies) < 0))
+                return -1;
+        }
+
+        return 0;
+    }
+
+    for (spec = strtok(spec, ","); spec; spec = strtok(NULL, ",")) {
+        if ((eq = strchr(spec, '=')) == NULL)
+            goto bad;
+
+        *eq++ = '\0';
+
+        if ((cmd = native_getcmd(spec)) < 0)
+            return -1;
+
+        copies = strtol(eq, &end, 10);
+
+        if ((end == eq) || *end)
+            goto bad;
+
+        if (br_set_copies(cinfo, cmd, copies) < 0)
+            return -1;
+    }
+
+    return 0;
+
+bad:
+    errno = EINVAL;
+    br_error("getcopies", "Copies should be \"default\", a number, or "
+      "CMD=NUM[,CMD=NUM...]");
+
+    return -1;
+}
+
 int native_cmdline(br_control_info *cinfo, int argc, char *argv[], int optind)
 {
 /*
@@ -413,14 +707,14 @@ int native_cmdline(br_control_info *cinfo, int argc, char *argv[], int optind)
             case ON:
                 if (native_getunits(argv[i], &units) < 0)
                     return -1;
-                if (br_add_ul_cmd(cinfo, ON, units) < 0)
+                if (br_add_ul_cmd_grouped(cinfo, ON, units) < 0)
                     return -1;
                 break;
         
             case OFF:
                 if (native_getunits(argv[i], &units) < 0)
                     return -1;
-                if (br_add_ul_cmd(cinfo, OFF, units) < 0)
+                if (br_add_ul_cmd_grouped(cinfo, OFF, units) < 0)
                     return -1;
                 break;
         
@@ -484,147 +778,972 @@ int native_cmdline(br_control_info *cinfo, int argc, char *argv[], int optind)
     return 0;
 }        
 
-int main(int argc, char **argv)
+int virtual_execute(br_plan *plan, int show_stats)
 {
-    char *port_source = "at compile time";
-    char *tmp_port;
-    char *port = X10_PORTNAME;
-    int opt;
-    int house = 0;
-    int repeat;
-    int dimlevel = 0;
-    int fd;
-    br_control_info *cinfo = NULL;
-    br_unit_list *units = NULL;
-    
-#ifdef HAVE_GETOPT_LONG
-    int opt_index;
-    static struct option long_options[] = {
-        {"help",       no_argument,            0, 'h'},
-        {"port",       required_argument,      0, 'x'},
-        {"repeat",     required_argument,      0, 'r'},
-        {"on",         required_argument,      0, 'n'},
-        {"off",        required_argument,      0, 'f'},
-        {"ON",         no_argument,            0, 'N'},
-        {"OFF",        no_argument,            0, 'F'},
-        {"dim",        required_argument,      0, 'd'},
-        {"lamps_on",   no_argument,            0, 'B'},
-        {"lamps_off",  no_argument,            0, 'D'},
-        {"inverse",    no_argument,            0, 'i'},
-        {"house",      required_argument,      0, 'c'},
-        {"verbose",    no_argument,            0, 'v'},
-        {"pause",      no_argument,            0, 'p'},
-        {0, 0, 0, 0}
-    };
-#endif
+    /*
+     * Send everything to a simulated port whose clock only moves when
+     *  we tell it to, then read the result back the way the receiver
+     *  would to make sure it's what we meant to send
+     */
+
+    br_backend *backend;
+    br_decoded *frames;
+    br_stats stats;
+    int numframes;
+    int wrong;
+    br_virtual *v;
+
+
+    if ((backend = br_new_virtual_backend()) == NULL)
+        return -1;
+
+    br_set_backend(backend);
+    v = br_virtual_state(backend);
+
+    if ((br_execute_plan(-1, plan) < 0)
+      || ((numframes = br_decode(v->transitions, v->numtransitions, NULL,
+        &frames)) < 0))
+    {
+        br_free_virtual_backend(backend);
+        return -1;
+    }
+
+    wrong = br_decode_compare(frames, numframes, plan);
+
+    printf("%s: %d line changes, %.3f seconds of airtime\n", MyName,
+      v->numtransitions, br_virtual_elapsed(backend) / 1000000.0);
+    printf("%s: %d frames decoded, %d not as intended\n", MyName,
+      numframes, wrong);
 
-#define OPT_STRING     "x:hvr:ic:n:Nf:Fd:BDp"
+    if (show_stats && (br_get_stats(&stats) == 0))
+        br_print_stats(stdout, &stats);
+
+    free(frames);
+    br_free_virtual_backend(backend);
+
+    return 0;
+}
 
+int getreceiver(br_sweep_opts *opts, char *spec)
+{
     /*
-     * Jimmy in the local error handler that hides the
-     *  function where the error occurred (to keep from
-     *  being confusing) and also prints the program name
+     * Read what the receiver needs: HALFBIT,HOLD,POST in uSec, and
+     *  optionally the margin to give it, in percent
      */
 
-    saved_br_error_handler = br_error_handler;
-    br_error_handler = my_br_error_handler;
+    long values[4];
+    char *end;
+    int n;
 
-    MyName = argv[0];
 
+    for (n = 0; n < 4; ) {
+        values[n] = strtol(spec, &end, 10);
+
+        if ((end == spec) || (values[n] < 0))
+            break;
+
+        n++;
+        spec = end;
+
+        if ((*spec != ',') || (n == 4))
+            break;
+
+        spec++;
+    }
+
+    if ((n < 3) || *spec) {
+        errno = EINVAL;
+        br_error(NULL, "Receiver needs should be HALFBIT,HOLD,POST[,MARGIN]");
+        return -1;
+    }
+
+    opts->model.min_half_bit = values[0];
+    opts->model.min_hold = values[1];
+    opts->model.min_post = values[2];
+
+    if (n == 4)
+        opts->model.margin = values[3];
+
+    return 0;
+}
+
+int sweep_execute(br_plan *plan, char *port, int virtual, char *name,
+  br_sweep_opts *opts, br_context *shipped, int receiver_given)
+{
     /*
-     * This is where we store all of the info to be passed to the
-     *  command engine.
+     * Send the commands at faster and faster timing until they stop
+     *  getting through (see br_sweep()), and save the quickest that
+     *  still did as a profile.
+     *
+     * Nothing can hear what the FireCracker really picked up, so what
+     *  decides whether a timing got through is only the model of the
+     *  receiver.  Timing quicker than br's own is only saved if the
+     *  model's been given with -M, by someone who knows their receiver.
      */
 
+    br_context best;
+    char comment[256];
+    int fd = -1;
+    int rv;
+
+
+    if (!virtual && ((fd = open_port(NULL, port)) < 0))
+        return -1;
+
+    if (Verbose >= 1)
+        opts->log = stdout;
+
+    rv = br_sweep(BR_CTX, fd, virtual ? NULL:&br_serial_backend, plan, opts,
+      &best);
+
+    if (!virtual)
+        close_port(fd);
+
+    if (rv < 0)
+        return -1;
+
+    printf("%s: inter-bit %d, pre %d, post %d uSec (from %d, %d, %d); "
+      "worked out from the receiver model, not verified\n", MyName,
+      best.inter_bit_delay, best.pre_cmd_delay, best.post_cmd_delay,
+      BR_CTX->inter_bit_delay, BR_CTX->pre_cmd_delay,
+      BR_CTX->post_cmd_delay);
+
+    if (!receiver_given
+      && ((best.inter_bit_delay < shipped->inter_bit_delay)
+      || (best.pre_cmd_delay < shipped->pre_cmd_delay)
+      || (best.post_cmd_delay < shipped->post_cmd_delay)))
+    {
+        errno = EINVAL;
+        br_error(NULL, "Timing quicker than the default rests only on "
+          "guesses about the receiver; give its needs with -M to save it");
+        return -1;
+    }
+
+    sprintf(comment, "model-derived, unverified: from %s --sweep on %.64s, "
+      "%d trials each; receiver needs %ld/%ld/%ld uSec + %d%%", MyName,
+      virtual ? "a virtual port":port, opts->trials,
+      opts->model.min_half_bit, opts->model.min_hold,
+      opts->model.min_post, opts->model.margin);
+
+    if (br_profile_save(name, &best, comment) < 0)
+        return -1;
+
+    printf("%s: saved as %s\n", MyName, name);
+
+    return 0;
+}
+
+br_control_info *plan_control_info(br_plan *plan)
+{
+/*
+ * Turn a plan back into a command list, for brd
+ */
+
+    br_control_info *cinfo;
+    register int i;
+    int unit;
+
+
     if ((cinfo = br_new_control_info()) == NULL)
-        exit(errno);
+        return NULL;
 
-    if ((tmp_port = getenv("X10_PORTNAME"))) {
-        port_source = "in the environment variable X10_PORTNAME";
+    cinfo->inverse = plan->inverse;
+    cinfo->repeat = plan->repeat;
+    cinfo->stream = plan->stream;
+    cinfo->gap = plan->gap;
 
-        if (checkimmutableport(port_source)) {
-            exit(errno);
-        } else {
-            port = tmp_port;
+    for (i = 0; i < plan->numframes; i++) {
+        unit = plan->frames[i].unit;
+
+        if (br_add_cmd(cinfo, plan->frames[i].cmd, BR_UNIT_HOUSE(unit),
+          BR_UNIT_DEV(unit)) < 0)
+        {
+            br_free_control_info(cinfo);
+            return NULL;
         }
     }
-    
-#ifdef HAVE_GETOPT_LONG
-    while ((opt = getopt_long(argc, argv, OPT_STRING, long_options,
-      &opt_index)) != -1)
-    {
-#else
-    while ((opt = getopt(argc, argv, OPT_STRING)) != -1) {
-#endif        
-        switch (opt) {
-            case 'x':                                  /* Set the port */
-                port_source = "on the command line";
-                if (checkimmutableport(port_source) < 0)
-                    exit(errno);
-                port = optarg;
-                break;
-            case 'r':                                /* Repeat */
-                repeat = atoi(optarg);
-                if (!repeat && !isdigit(*optarg)) {
-                    errno = EINVAL;
-                    br_error(NULL, "Invalid repeat value");
-                    exit(errno);
-                }
-                cinfo->repeat = (repeat ? repeat:INT_MAX);
-                break;
-            case 'v':                                /* Verbose */
-                if (Verbose++ == 10)
-                    fprintf(stderr, "\nGet a LIFE already.  "
-                      "I've got enough v's, thanks.\n\n");
-                if (Verbose >= 4)
-                    br_verbose = Verbose - 3;
-                break;
-            case 'i':
-                cinfo->inverse++;    /* no this isn't documented.
-                                      *   your free gift for reading the source.
-                                      */
+
+    return cinfo;
+}
+
+int add_option(br_control_info *cinfo, int opt, char *arg,
+  br_unit_list **units)
+{
+/*
+ * The options that add commands (or set the housecode they go to),
+ *  whether they came from the command line or a line of input
+ */
+
+    int dimlevel;
+    int absolute;
+    int house;
+
+
+    switch (opt) {
+        case 'c':                                /* Set housecode */
+            if ((house = gethouse(arg)) < 0)
+                return -1;
+            br_default_house = house;
+            break;
+        case 'n':                                /* Device(s) on */
+            if (getunits(arg, units) < 0)
+                return -1;
+            if (br_add_ul_cmd_grouped(cinfo, ON, *units) < 0)
+                return -1;
+            break;
+        case 'N':                                /* All on */
+            if (br_add_cmd(cinfo, ALL_ON, br_default_house, 0) < 0)
+                return -1;
+            break;
+        case 'f':                                /* Device(s) off */
+            if (getunits(arg, units) < 0)
+                return -1;
+            if (br_add_ul_cmd_grouped(cinfo, OFF, *units) < 0)
+                return -1;
+            break;
+        case 'F':                                /* All off */
+            if (br_add_cmd(cinfo, ALL_OFF, br_default_house, 0) < 0)
+                return -1;
+            break;
+        case 'd':                                /* Dim (/bright) */
+            if (getdim(arg, units, &dimlevel, &absolute) < 0)
+                return -1;
+            if (add_dimcmd(cinfo, *units, dimlevel, absolute) < 0)
+                return -1;
+            break;
+        case 'B':                                /* All lamps on */
+            if (br_add_cmd(cinfo, ALL_LAMPS_ON, br_default_house, 0) < 0)
+                return -1;
+            break;
+        case 'D':                                /* All lamps off */
+            if (br_add_cmd(cinfo, ALL_LAMPS_OFF, br_default_house, 0) < 0)
+                return -1;
+            break;
+        case 'p':
+            if (br_add_cmd(cinfo, PAUSE, 0, 0) < 0)
+                return -1;
+            break;
+        default:
+            errno = EINVAL;
+            br_error("add_option", "Not a command option");
+            return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * Command options that make sense on a line of input
+ */
+
+static struct {
+    char *name;
+    int opt;
+    int has_arg;
+} line_options[] = {
+    {"house",      'c', 1},
+    {"on",         'n', 1},
+    {"ON",         'N', 0},
+    {"off",        'f', 1},
+    {"OFF",        'F', 0},
+    {"dim",        'd', 1},
+    {"lamps_on",   'B', 0},
+    {"lamps_off",  'D', 0},
+    {"pause",      'p', 0},
+    {NULL,         0,   0}
+};
+
+int parse_line(br_control_info *cinfo, char *line, br_unit_list **units)
+{
+/*
+ * One line of input: either native commands ("A1,3 ON B DIM") or
+ *  options ("-n A1,3 -d -4"), same as on the command line.  Anything
+ *  after a '#' is a comment.
+ */
+
+    char *args[MAX_LINE_ARGS];
+    char *arg;
+    char *val;
+    int numargs = 0;
+    register int i;
+    int j;
+
+
+    if ((arg = strchr(line, '#')))
+        *arg = '\0';
+
+    for (arg = strtok(line, " \t\r\n"); arg; arg = strtok(NULL, " \t\r\n")) {
+        if (numargs == MAX_LINE_ARGS) {
+            errno = E2BIG;
+            br_error("parse_line", "Too many commands on one line");
+            return -1;
+        }
+
+        args[numargs++] = arg;
+    }
+
+    if (numargs == 0)
+        return 0;
+
+    if (*args[0] != '-') {
+        if (numargs % 2) {
+            errno = EINVAL;
+            br_error("parse_line", "Native commands come in pairs: "
+              "<housecode>(<list>) <native cmd>");
+            return -1;
+        }
+
+        return native_cmdline(cinfo, numargs, args, 0);
+    }
+
+    for (i = 0; i < numargs; i++) {
+        arg = args[i];
+        val = NULL;
+
+        if (arg[0] != '-')
+            goto bad;
+
+        for (j = 0; line_options[j].name; j++) {
+            if (arg[1] == '-') {
+                if ((val = strchr(arg, '=')))
+                    *val++ = '\0';
+
+                if (!strcmp(arg + 2, line_options[j].name))
+                    break;
+
+                if (val)
+                    *--val = '=';
+            } else if (arg[1] == line_options[j].opt) {
+                if (arg[2])
+                    val = arg + 2;
                 break;
-            case 'c':                                /* Set housecode */
-                if ((br_default_house = gethouse(optarg)) < 0)
+            }
+        }
+
+        if (line_options[j].name == NULL)
+            goto bad;
+
+        if (line_options[j].has_arg && (val == NULL)) {
+            if (++i == numargs)
+                goto bad;
+            val = args[i];
+        }
+
+        if (add_option(cinfo, line_options[j].opt, val, units) < 0)
+            return -1;
+    }
+
+    return 0;
+
+bad:
+    errno = EINVAL;
+    br_error("parse_line", "Bad option");
+
+    return -1;
+}
+
+int prepare(br_control_info *cinfo, int optimize, long suppress)
+{
+/*
+ * Whatever trimming was asked for, before a list goes out.  It may not
+ *  leave anything.
+ */
+
+    br_opt_stats opt_stats;
+    int dropped;
+
+
+    if (optimize && br_get_num_commands(cinfo)) {
+        if (br_optimize(cinfo, &opt_stats) < 0)
+            return -1;
+
+        if (Verbose >= 1)
+            printf("%s: Optimized %d frames down to %d, saving %.1f seconds"
+              " per pass\n", MyName, opt_stats.frames_before,
+              opt_stats.frames_after, opt_stats.usecs_saved / 1000000.0);
+    }
+
+    /*
+     * Nothing recorded yet just means nothing to skip
+     */
+
+    if ((suppress >= 0) && br_get_num_commands(cinfo) && read_state()) {
+        if ((dropped = br_state_filter(read_state(), cinfo, suppress)) < 0)
+            return -1;
+
+        if (Verbose >= 1)
+            printf("%s: Skipped %d frames for units already set\n", MyName,
+              dropped);
+    }
+
+    return 0;
+}
+
+/*
+ * Where streamed command lists go: brd, if it's there, or an engine
+ *  running on our own port.  Either way up to STREAM_DEPTH of them can
+ *  be on their way at once; after that, reading waits for the oldest.
+ */
+
+struct stream_sink {
+    int mode;                    /* SINK_* */
+    br_engine *engine;
+    br_backend *backend;         /* -T */
+    int fd;
+    char *port;
+    char *sockname;
+    int local;
+    int virtual;
+    int rt;
+    int cpu;
+    int show_stats;
+    int oldest;
+    int count;
+    struct {
+        br_request *req;         /* ours */
+        int sock;                /* or brd's */
+        int line;
+    } flight[STREAM_DEPTH];
+    int failed;
+};
+
+#define SINK_UNDECIDED  0
+#define SINK_DAEMON     1
+#define SINK_LOCAL      2
+
+void sink_setup(int port, void *arg)
+{
+    realtime(*(int *)arg);
+}
+
+int sink_start(stream_sink *sink, br_control_info *cinfo)
+{
+/*
+ * Work out where lists are going when the first one's ready to go
+ */
+
+    int sock;
+
+
+    if (!sink->local && ((sock = br_daemon_connect(sink->sockname)) >= 0)) {
+        sink->mode = SINK_DAEMON;
+
+        if (Verbose >= 2)
+            printf("%s: Handing commands to brd on %s\n", MyName,
+              sink->sockname);
+
+        return sock;
+    }
+
+    if (sink->virtual) {
+        if ((sink->backend = br_new_virtual_backend()) == NULL)
+            return -1;
+
+        br_set_backend(sink->backend);
+        sink->fd = -1;
+    } else {
+        if ((sink->fd = open_port(cinfo, sink->port)) < 0)
+            return -1;
+
+        /*
+         * Keep everyone else up to date on what we've sent
+         */
+
+        br_state_use(br_state_open(NULL, 1));
+    }
+
+    if ((sink->engine = br_engine_start(sink->fd,
+      sink->rt ? sink_setup:NULL, &sink->cpu)) == NULL)
+        return -1;
+
+    sink->mode = SINK_LOCAL;
+
+    return -1;
+}
+
+int sink_finish(stream_sink *sink)
+{
+/*
+ * Wait for the oldest list on its way
+ */
+
+    int slot = sink->oldest;
+    int status;
+    int err;
+    char msg[80];
+
+
+    if (sink->count == 0)
+        return 0;
+
+    sink->oldest = (sink->oldest + 1) % STREAM_DEPTH;
+    sink->count--;
+
+    if (sink->mode == SINK_DAEMON) {
+        if (br_recv_status(sink->flight[slot].sock, &status, &err) < 0)
+            err = errno;
+        else if (status >= 0)
+            err = 0;
+
+        close(sink->flight[slot].sock);
+    } else {
+        br_wait(sink->flight[slot].req, -1);
+
+        err = (br_request_status(sink->flight[slot].req) == BR_REQ_FAILED) ?
+          sink->flight[slot].req->error:0;
+
+        br_free_request(sink->flight[slot].req);
+    }
+
+    if (err) {
+        sprintf(msg, "Commands from line %d were not sent",
+          sink->flight[slot].line);
+        errno = err;
+        br_error("sink_finish", msg);
+        sink->failed++;
+        return -1;
+    }
+
+    return 0;
+}
+
+int sink_drain(stream_sink *sink)
+{
+    int rv = 0;
+
+
+    while (sink->count) {
+        if (sink_finish(sink) < 0)
+            rv = -1;
+    }
+
+    return rv;
+}
+
+int sink_put(stream_sink *sink, br_control_info *cinfo, int line)
+{
+/*
+ * Send a list on its way; the sink owns it from here
+ */
+
+    int slot;
+    int sock = -1;
+    int tmperrno;
+
+
+    if (sink->count == STREAM_DEPTH)
+        sink_finish(sink);
+
+    slot = (sink->oldest + sink->count) % STREAM_DEPTH;
+    sink->flight[slot].line = line;
+
+    if ((sink->mode == SINK_UNDECIDED)
+      && ((sock = sink_start(sink, cinfo)) < 0)
+      && (sink->mode == SINK_UNDECIDED))
+        goto fail;
+
+    if (sink->mode == SINK_DAEMON) {
+        if ((sock < 0) && ((sock = br_daemon_connect(sink->sockname)) < 0))
+            goto fail;
+
+        if (br_send_control_info(sock, cinfo) < 0) {
+            close(sock);
+            goto fail;
+        }
+
+        br_free_control_info(cinfo);
+        sink->flight[slot].sock = sock;
+    } else {
+        if ((sink->flight[slot].req = br_submit(sink->engine, cinfo, NULL,
+          NULL)) == NULL)
+            goto fail;
+    }
+
+    sink->count++;
+
+    return 0;
+
+fail:
+    tmperrno = errno;
+    br_free_control_info(cinfo);
+    sink->failed++;
+    errno = tmperrno;
+
+    return -1;
+}
+
+int sink_close(stream_sink *sink)
+{
+    br_stats stats;
+    br_virtual *v;
+
+
+    sink_drain(sink);
+
+    if (sink->engine) {
+        if (sink->show_stats
+          && (br_engine_get_stats(sink->engine, 0, &stats) == 0))
+            br_print_stats(stdout, &stats);
+
+        br_engine_stop(sink->engine);
+    }
+
+    if (sink->backend) {
+        v = br_virtual_state(sink->backend);
+
+        printf("%s: %d line changes, %.3f seconds of airtime\n", MyName,
+          v->numtransitions, br_virtual_elapsed(sink->backend) / 1000000.0);
+
+        br_free_virtual_backend(sink->backend);
+    } else if (sink->mode == SINK_LOCAL) {
+        br_state_close(br_state_use(NULL));
+        close_port(sink->fd);
+    }
+
+    return sink->failed ? -1:0;
+}
+
+int stream_execute(stream_sink *sink, FILE *in, char *name,
+  br_control_info *proto, int optimize, long suppress)
+{
+/*
+ * Send commands a line at a time as they're read, with the port (or
+ *  brd) kept open the whole time.  Every line gets the options from the
+ *  command line, and its own go at -o and -s.  Lines that don't parse or
+ *  don't go out are reported and skipped.
+ */
+
+    char line[MAX_LINE_LEN];
+    char msg[80];
+    br_control_info *cinfo;
+    br_unit_list *units = NULL;
+    int lineno = 0;
+    int c;
+
+
+    Sink = sink;
+
+    while (fgets(line, sizeof(line), in)) {
+        lineno++;
+
+        if (!strchr(line, '\n') && !feof(in)) {
+            while (((c = getc(in)) != EOF) && (c != '\n'))
+                ;
+
+            errno = E2BIG;
+            sprintf(msg, "%.40s, line %d: Too long", name, lineno);
+            br_error("stream_execute", msg);
+            sink->failed++;
+            continue;
+        }
+
+        if ((cinfo = br_new_control_info()) == NULL)
+            break;
+
+        cinfo->inverse = proto->inverse;
+        cinfo->repeat = proto->repeat;
+        cinfo->retx = proto->retx;
+        cinfo->stream = proto->stream;
+        cinfo->priority = proto->priority;
+        cinfo->gap = proto->gap;
+
+        if ((parse_line(cinfo, line, &units) < 0)
+          || (prepare(cinfo, optimize, suppress) < 0))
+        {
+            sprintf(msg, "%.40s, line %d: Skipped", name, lineno);
+            br_error("stream_execute", msg);
+            sink->failed++;
+            br_free_control_info(cinfo);
+            continue;
+        }
+
+        if (!br_get_num_commands(cinfo)) {
+            br_free_control_info(cinfo);
+            continue;
+        }
+
+        /*
+         * If there's nowhere to send anything, there's no point going on
+         */
+
+        if ((sink_put(sink, cinfo, lineno) < 0)
+          && (sink->mode == SINK_UNDECIDED))
+            break;
+    }
+
+    if (ferror(in)) {
+        br_error("stream_execute", "Error reading commands");
+        sink->failed++;
+    }
+
+    Sink = NULL;
+
+    if (units)
+        br_free_unit_list(units);
+
+    return sink_close(sink);
+}
+
+int main(int argc, char **argv)
+{
+    char *port_source = "at compile time";
+    char *tmp_port;
+    char *port = X10_PORTNAME;
+    int opt;
+    int repeat;
+    int spread;
+    int fd;
+    int local = 0;
+    int optimize = 0;
+    int rt = 0;
+    int cpu = -1;
+    int show_stats = 0;
+    int virtual = 0;
+    int status = 0;
+    long suppress = -1;
+    br_state *state = NULL;
+    char *input = NULL;
+    char *compile = NULL;
+    char *play = NULL;
+    char *sweep = NULL;
+    br_sweep_opts sweep_opts;
+    br_context shipped;
+    int receiver_given = 0;
+    br_plan *plan = NULL;
+    FILE *in;
+    stream_sink sink;
+    br_control_info *proto;
+    br_stats stats;
+    int rv;
+    char *sockname = BRD_SOCKNAME;
+    br_control_info *cinfo = NULL;
+    br_unit_list *units = NULL;
+    
+#ifdef HAVE_GETOPT_LONG
+    int opt_index;
+    static struct option long_options[] = {
+        {"help",       no_argument,            0, 'h'},
+        {"port",       required_argument,      0, 'x'},
+        {"repeat",     required_argument,      0, 'r'},
+        {"on",         required_argument,      0, 'n'},
+        {"off",        required_argument,      0, 'f'},
+        {"ON",         no_argument,            0, 'N'},
+        {"OFF",        no_argument,            0, 'F'},
+        {"dim",        required_argument,      0, 'd'},
+        {"lamps_on",   no_argument,            0, 'B'},
+        {"lamps_off",  no_argument,            0, 'D'},
+        {"inverse",    no_argument,            0, 'i'},
+        {"house",      required_argument,      0, 'c'},
+        {"verbose",    no_argument,            0, 'v'},
+        {"pause",      no_argument,            0, 'p'},
+        {"local",      no_argument,            0, 'l'},
+        {"optimize",   no_argument,            0, 'o'},
+        {"back-to-back", no_argument,          0, 'b'},
+        {"gap",        required_argument,      0, 'g'},
+        {"priority",   required_argument,      0, 'P'},
+        {"realtime",   no_argument,            0, 'R'},
+        {"cpu",        required_argument,      0, 'C'},
+        {"stats",      no_argument,            0, 'S'},
+        {"virtual",    no_argument,            0, 'T'},
+        {"suppress",   required_argument,      0, 's'},
+        {"status",     no_argument,            0, 'q'},
+        {"recalibrate", no_argument,           0, 'Z'},
+        {"stdin",      no_argument,            0, 'I'},
+        {"file",       required_argument,      0, 'k'},
+        {"compile",    required_argument,      0, 'w'},
+        {"play",       required_argument,      0, 'y'},
+        {"copies",     required_argument,      0, 't'},
+        {"spread",     required_argument,      0, 'u'},
+        {"profile",    required_argument,      0, 'L'},
+        {"sweep",      required_argument,      0, 'W'},
+        {"receiver",   required_argument,      0, 'M'},
+        {0, 0, 0, 0}
+    };
+#endif
+
+#define OPT_STRING     "x:hvr:ic:n:Nf:Fd:BDplobg:P:RC:STs:qZIk:w:y:t:u:L:W:M:"
+
+    /*
+     * Jimmy in the local error handler that hides the
+     *  function where the error occurred (to keep from
+     *  being confusing) and also prints the program name
+     */
+
+    saved_br_error_handler = br_error_handler;
+    br_error_handler = my_br_error_handler;
+
+    MyName = argv[0];
+
+    /*
+     * This is where we store all of the info to be passed to the
+     *  command engine.
+     */
+
+    if ((cinfo = br_new_control_info()) == NULL)
+        exit(errno);
+
+    br_sweep_init_opts(&sweep_opts);
+
+    /*
+     * The timing br comes with, before any options or profiles
+     */
+
+    shipped = br_default_context;
+
+    if ((tmp_port = getenv("X10_PORTNAME"))) {
+        port_source = "in the environment variable X10_PORTNAME";
+
+        if (checkimmutableport(port_source)) {
+            exit(errno);
+        } else {
+            port = tmp_port;
+        }
+    }
+
+    if (getenv("BRD_SOCKNAME"))
+        sockname = getenv("BRD_SOCKNAME");
+
+#ifdef HAVE_GETOPT_LONG
+    while ((opt = getopt_long(argc, argv, OPT_STRING, long_options,
+      &opt_index)) != -1)
+    {
+#else
+    while ((opt = getopt(argc, argv, OPT_STRING)) != -1) {
+#endif        
+        switch (opt) {
+            case 'x':                                  /* Set the port */
+                port_source = "on the command line";
+                if (checkimmutableport(port_source) < 0)
                     exit(errno);
-		house = br_default_house;
+                port = optarg;
+                local = 1;     /* brd may well be running another port */
                 break;
-            case 'n':                                /* Device(s) on */
-                if (getunits(optarg, &units) < 0)
-                    exit(errno);
-                if (br_add_ul_cmd(cinfo, ON, units) < 0)
+            case 'l':                                  /* Skip brd */
+                local = 1;
+                break;
+            case 'o':                                  /* Optimize */
+                optimize = 1;
+                break;
+            case 'b':                                  /* Back-to-back */
+                cinfo->stream = 1;
+                break;
+            case 'S':                                  /* Statistics */
+                show_stats = 1;
+                local = 1;     /* they'd be brd's, not ours */
+                break;
+            case 'T':                                  /* Virtual port */
+                virtual = 1;
+                local = 1;
+                break;
+            case 'R':                                  /* Real-time */
+                rt = 1;
+                break;
+            case 'C':                                  /* CPU for real-time */
+                cpu = atoi(optarg);
+                if ((cpu < 0) || (!cpu && !isdigit(*optarg))) {
+                    errno = EINVAL;
+                    br_error(NULL, "Invalid CPU number");
                     exit(errno);
+                }
                 break;
-            case 'N':                                /* All on */
-                if (br_add_cmd(cinfo, ALL_ON, house, 0) < 0)
+            case 'g':                                  /* Inter-frame gap */
+                br_inter_frame_delay = atoi(optarg);
+                if ((br_inter_frame_delay < 0)
+                  || (!br_inter_frame_delay && !isdigit(*optarg)))
+                {
+                    errno = EINVAL;
+                    br_error(NULL, "Invalid gap value");
                     exit(errno);
+                }
+                cinfo->gap = br_inter_frame_delay;
                 break;
-            case 'f':                                /* Device(s) off */
-                if (getunits(optarg, &units) < 0)
+            case 'P':                                  /* Priority */
+                if ((cinfo->priority = getpri(optarg)) < 0)
                     exit(errno);
-                if (br_add_ul_cmd(cinfo, OFF, units) < 0)
+                break;
+            case 't':                                  /* Copies */
+                if (getcopies(cinfo, optarg) < 0)
                     exit(errno);
                 break;
-            case 'F':                                /* All off */
-                if (br_add_cmd(cinfo, ALL_OFF, house, 0) < 0)
+            case 'u':                                  /* Spread of copies */
+                spread = atoi(optarg);
+                if ((spread < 0) || (!spread && !isdigit(*optarg))) {
+                    errno = EINVAL;
+                    br_error(NULL, "Invalid spread");
                     exit(errno);
+                }
+                br_set_spread(cinfo, spread);
                 break;
-            case 'd':                                /* Dim (/bright) */
-                if (getdim(optarg, &units, &dimlevel) < 0)
+            case 's':                                  /* Suppress */
+                suppress = atol(optarg);
+                if ((suppress < 0) || (!suppress && !isdigit(*optarg))) {
+                    errno = EINVAL;
+                    br_error(NULL, "Invalid suppress age");
                     exit(errno);
-                if (add_dimcmd(cinfo, units, dimlevel) < 0)
+                }
+                break;
+            case 'q':                                  /* Unit status */
+                status = 1;
+                break;
+            case 'Z':                                  /* Don't trust levels */
+                Recalibrate = 1;
+                break;
+            case 'I':                                  /* Commands on stdin */
+                input = "-";
+                break;
+            case 'k':                                  /* Commands in a file */
+                input = optarg;
+                break;
+            case 'w':                                  /* Save a plan */
+                compile = optarg;
+                break;
+            case 'y':                                  /* Play a saved plan */
+                play = optarg;
+                break;
+            case 'L':                                  /* Timing profile */
+                if (br_profile_load(optarg, &br_default_context) < 0)
                     exit(errno);
                 break;
-            case 'B':                                /* All lamps on */
-                if (br_add_cmd(cinfo, ALL_LAMPS_ON, house, 0) < 0)
+            case 'W':                                  /* Sweep for one */
+                sweep = optarg;
+                local = 1;
+                break;
+            case 'M':                                  /* Receiver's needs */
+                if (getreceiver(&sweep_opts, optarg) < 0)
                     exit(errno);
+                receiver_given = 1;
                 break;
-            case 'D':                                /* All lamps off */
-                if (br_add_cmd(cinfo, ALL_LAMPS_OFF, house, 0) < 0)
+            case 'r':                                /* Repeat */
+                repeat = atoi(optarg);
+                if (!repeat && !isdigit(*optarg)) {
+                    errno = EINVAL;
+                    br_error(NULL, "Invalid repeat value");
                     exit(errno);
+                }
+                cinfo->repeat = (repeat ? repeat:INT_MAX);
                 break;
+            case 'v':                                /* Verbose */
+                if (Verbose++ == 10)
+                    fprintf(stderr, "\nGet a LIFE already.  "
+                      "I've got enough v's, thanks.\n\n");
+                if (Verbose >= 4)
+                    br_verbose = Verbose - 3;
+                break;
+            case 'i':
+                cinfo->inverse++;    /* no this isn't documented.
+                                      *   your free gift for reading the source.
+                                      */
+                break;
+            case 'c':                                /* Commands */
+            case 'n':
+            case 'N':
+            case 'f':
+            case 'F':
+            case 'd':
+            case 'B':
+            case 'D':
             case 'p':
-                if (br_add_cmd(cinfo, PAUSE, 0, 0) < 0)
+                if (add_option(cinfo, opt, optarg, &units) < 0)
                     exit(errno);
                 break;
             case 'h':                                /* Help */
@@ -645,27 +1764,186 @@ int main(int argc, char **argv)
             exit(errno);
     }
 
-    if (!br_get_num_commands(cinfo)) {
-        usage();
-        exit(EINVAL);
+    if (status) {
+        if ((state = br_state_open(NULL, 0)) == NULL)
+            exit(errno);
+
+        br_state_print(stdout, state);
+        br_state_close(state);
+
+        exit(0);
     }
 
-    if ((fd = open_port(cinfo, port)) < 0)
-        exit(errno);
+    if (input) {
+        if (!strcmp(input, "-")) {
+            in = stdin;
+            input = "stdin";
+        } else if ((in = fopen(input, "r")) == NULL) {
+            br_error(NULL, "Unable to open command file");
+            exit(errno);
+        }
 
-    if (Verbose >= 2)
-        printf("%s: Executing %d commands\n", MyName,
-          br_get_num_commands(cinfo));
+        memset(&sink, 0, sizeof(sink));
+        sink.port = port;
+        sink.sockname = sockname;
+        sink.local = local;
+        sink.virtual = virtual;
+        sink.rt = rt;
+        sink.cpu = cpu;
+        sink.show_stats = show_stats;
+
+        /*
+         * Anything on the command line goes first; every line read gets
+         *  the same options
+         */
+
+        if ((proto = br_new_control_info()) == NULL)
+            exit(errno);
+
+        proto->inverse = cinfo->inverse;
+        proto->repeat = cinfo->repeat;
+        proto->retx = cinfo->retx;
+        proto->stream = cinfo->stream;
+        proto->priority = cinfo->priority;
+        proto->gap = cinfo->gap;
+
+        if (prepare(cinfo, optimize, suppress) < 0)
+            exit(errno);
+
+        if (br_get_num_commands(cinfo))
+            sink_put(&sink, cinfo, 0);
+        else
+            br_free_control_info(cinfo);
+
+        rv = stream_execute(&sink, in, input, proto, optimize, suppress);
+
+        br_free_control_info(proto);
+        br_free_unit_list(units);
+
+        if (in != stdin)
+            fclose(in);
+
+        exit(rv < 0 ? (errno ? errno:EIO):0);
+    }
+
+    if (play) {
+        if (br_get_num_commands(cinfo)) {
+            errno = EINVAL;
+            br_error(NULL, "A plan can't be played along with other commands");
+            exit(errno);
+        }
+
+        if ((plan = br_load_plan(play)) == NULL)
+            exit(errno);
+
+        /*
+         * A gap given here beats the one the plan was saved with; either
+         *  way it goes with the plan, to brd too
+         */
+
+        if (br_inter_frame_delay >= 0)
+            plan->gap = br_inter_frame_delay;
+    } else {
+        if (!br_get_num_commands(cinfo)) {
+            usage();
+            exit(EINVAL);
+        }
+
+        /*
+         * What's already on record today doesn't belong in a plan for
+         *  later
+         */
+
+        if (prepare(cinfo, optimize, compile ? -1:suppress) < 0)
+            exit(errno);
+
+        if (!br_get_num_commands(cinfo))
+            exit(0);     /* Everything cancelled out, or was already done */
+
+        if (compile) {
+            if (((plan = br_compile(cinfo)) == NULL)
+              || (br_save_plan(plan, compile) < 0))
+                exit(errno);
+
+            if (Verbose >= 1)
+                printf("%s: Wrote %d frames to %s\n", MyName,
+                  plan->numframes, compile);
+
+            exit(0);
+        }
+    }
+
+    if (sweep) {
+        if ((plan == NULL) && ((plan = br_compile(cinfo)) == NULL))
+            exit(errno);
+
+        if (sweep_execute(plan, port, virtual, sweep, &sweep_opts,
+          &shipped, receiver_given) < 0)
+            exit(errno);
+
+        exit(0);
+    }
 
-    if (br_execute(fd, cinfo) < 0)
+    /*
+     * If there's a daemon holding the port, let it do the work so we
+     *  don't end up fighting with it (or anyone else) over the lines.
+     */
+
+    if (local) {
+        rv = 1;
+    } else if (plan) {
+        br_free_control_info(cinfo);
+
+        if ((cinfo = plan_control_info(plan)) == NULL)
+            exit(errno);
+
+        rv = daemon_execute(cinfo, sockname);
+    } else {
+        rv = daemon_execute(cinfo, sockname);
+    }
+
+    if (rv < 0)
         exit(errno);
-            
-    if (close_port(fd) < 0)
+
+    if ((rv > 0) && (plan == NULL) && ((plan = br_compile(cinfo)) == NULL))
         exit(errno);
 
+    if (rv > 0 && virtual) {
+        if (virtual_execute(plan, show_stats) < 0)
+            exit(errno);
+    } else if (rv > 0) {
+        if (rt)
+            realtime(cpu);
+
+        if ((fd = open_port(cinfo, port)) < 0)
+            exit(errno);
+
+        /*
+         * Keep everyone else up to date on what we've sent
+         */
+
+        if ((state = br_state_open(NULL, 1)))
+            br_state_use(state);
+
+        if (Verbose >= 2)
+            printf("%s: Sending %d frames\n", MyName, plan->numframes);
+
+        if (br_execute_plan(fd, plan) < 0)
+            exit(errno);
+
+        if (close_port(fd) < 0)
+            exit(errno);
+
+        br_state_close(state);
+
+        if (show_stats && (br_get_stats(&stats) == 0))
+            br_print_stats(stdout, &stats);
+    }
+
     if (Verbose >= 3)
         printf("%s: Cleaning up...\n", MyName);
 
+    br_free_plan(plan);
     br_free_unit_list(units);
     br_free_control_info(cinfo);
 
@@ -0,0 +1,229 @@
+/*
+ * br_arena.c -- Region allocation for command lists: everything a
+ *  control info needs comes out of a few blocks that grow geometrically,
+ *  and goes back in one go.
+ *  (c) 1999 by Tymm Twillman (tymm@acm.org).
+ *
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ */
+
+#ifdef __cplusplus
+extern C {
+#endif
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#endif
+
+#include "br_cmd.h"
+#include "br_arena.h"
+
+/*
+ * Everything handed out is aligned well enough for anything we keep
+ */
+
+#define ARENA_ALIGN     (2 * sizeof(void *))
+#define ARENA_ROUND(n)  (((n) + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1))
+#define BLOCK_HDR       ARENA_ROUND(sizeof(br_arena_block))
+#define BLOCK_DATA(b)   ((char *)(b) + BLOCK_HDR)
+
+
+static br_arena_block *new_block(br_arena *arena, size_t size)
+{
+    br_arena_block *block;
+
+
+    block = malloc(BLOCK_HDR + size);
+
+    if (block == NULL) {
+        br_error("br_arena", "malloc");
+        return NULL;
+    }
+
+#ifdef MEM_DEBUG
+    printf("br_arena: Malloced %d bytes at %lx\n", BLOCK_HDR + size,
+      (unsigned long)block);
+#endif
+
+    block->size = size;
+    block->used = 0;
+    block->next = arena->blocks;
+    arena->blocks = block;
+
+    return block;
+}
+
+br_arena *br_new_arena(size_t size)
+{
+    br_arena *arena;
+
+
+    arena = malloc(sizeof(br_arena));
+
+    if (arena == NULL) {
+        br_error("br_new_arena", "malloc");
+        return NULL;
+    }
+
+    arena->blocks = NULL;
+    arena->last = NULL;
+
+    if (size && (new_block(arena, ARENA_ROUND(size)) == NULL)) {
+        free(arena);
+        return NULL;
+    }
+
+    return arena;
+}
+
+int br_free_arena(br_arena *arena)
+{
+    br_arena_block *block;
+
+
+    if (arena == NULL)
+        return 0;
+
+    while ((block = arena->blocks) != NULL) {
+        arena->blocks = block->next;
+
+#ifdef MEM_DEBUG
+        printf("br_free_arena: Freeing memory at %lx\n", (unsigned long)block);
+#endif
+
+        free(block);
+    }
+
+    free(arena);
+
+    return 0;
+}
+
+void *br_arena_alloc(br_arena *arena, size_t size)
+{
+    br_arena_block *block = arena->blocks;
+    size_t want;
+    void *p;
+
+
+    size = ARENA_ROUND(size);
+
+    if ((block == NULL) || (block->used + size > block->size)) {
+
+        /*
+         * Each new block is at least twice the size of the last, so
+         *  there are only ever a handful of them
+         */
+
+        want = block ? block->size * 2:ARENA_BLKSIZE;
+
+        while (want < size)
+            want *= 2;
+
+        if ((block = new_block(arena, want)) == NULL)
+            return NULL;
+    }
+
+    p = BLOCK_DATA(block) + block->used;
+    block->used += size;
+    arena->last = p;
+
+    return p;
+}
+
+void *br_arena_realloc(br_arena *arena, void *old, size_t oldsize,
+  size_t newsize)
+{
+/*
+ * If old was the last thing handed out and there's room after it, it
+ *  just gets longer; otherwise it's copied somewhere new (and the old
+ *  space stays used until the arena is reset).
+ */
+
+    br_arena_block *block = arena->blocks;
+    void *p;
+
+
+    if (old == NULL)
+        return br_arena_alloc(arena, newsize);
+
+    oldsize = ARENA_ROUND(oldsize);
+    newsize = ARENA_ROUND(newsize);
+
+    if (newsize <= oldsize)
+        return old;
+
+    if ((old == arena->last)
+      && (block->used - oldsize + newsize <= block->size))
+    {
+        block->used += newsize - oldsize;
+        return old;
+    }
+
+    if ((p = br_arena_alloc(arena, newsize)) == NULL)
+        return NULL;
+
+    memcpy(p, old, oldsize);
+
+    return p;
+}
+
+int br_arena_reset(br_arena *arena)
+{
+/*
+ * Give back everything at once.  The newest block is the biggest, so
+ *  it's kept for next time (the rest are freed); once an arena has grown
+ *  to fit what goes in it, reusing it doesn't touch malloc() at all.
+ */
+
+    br_arena_block *block;
+    br_arena_block *next;
+
+
+    if ((arena == NULL) || (arena->blocks == NULL))
+        return 0;
+
+    for (block = arena->blocks->next; block; block = next) {
+        next = block->next;
+
+#ifdef MEM_DEBUG
+        printf("br_arena_reset: Freeing memory at %lx\n",
+          (unsigned long)block);
+#endif
+
+        free(block);
+    }
+
+    arena->blocks->next = NULL;
+    arena->blocks->used = 0;
+    arena->last = NULL;
+
+    return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,48 @@
+#ifndef _BR_ARENA_H
+#define _BR_ARENA_H
+
+/*
+ * br_arena.h -- A simple region allocator: lots of little allocations
+ *               carved out of a few big blocks, all given back at once.
+ *
+ * (c) 1999 Tymm Twillman (tymm@acm.org)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <sys/types.h>
+
+#define ARENA_BLKSIZE 4096   /* size of an arena's first block */
+
+typedef struct br_arena_block {
+    struct br_arena_block *next;
+    size_t size;
+    size_t used;
+} br_arena_block;            /* the space itself follows */
+
+typedef struct {
+    br_arena_block *blocks;  /* newest (and biggest) first */
+    void *last;              /* latest allocation; can grow in place */
+} br_arena;
+
+br_arena *br_new_arena(size_t /* first block size */);
+int br_free_arena(br_arena *);
+void *br_arena_alloc(br_arena *, size_t);
+void *br_arena_realloc(br_arena *, void *, size_t /* old size */,
+              size_t /* new size */);
+int br_arena_reset(br_arena *);
+
+#endif
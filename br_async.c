@@ -0,0 +1,1205 @@
+/*
+ * br_async.c -- Asynchronous sending: submission queues any number of
+ *  threads can push onto without locking, each drained by the transmit
+ *  thread that owns one port, with command lists split up between ports
+ *  by where their units are.
+ *  (c) 1999 by Tymm Twillman (tymm@acm.org).
+ *
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ */
+
+#ifdef __cplusplus
+extern C {
+#endif
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <pthread.h>
+
+#ifdef __linux__
+#include <sys/eventfd.h>
+#endif
+
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#endif
+
+#include "br_cmd.h"
+#include "br_plan.h"
+#include "br_backend.h"
+#include "br_async.h"
+
+/*
+ * The few atomic operations the queue needs.  They're all sequentially
+ *  consistent; the transmit thread going to sleep depends on that (see
+ *  next_part()).
+ */
+
+#ifdef __GNUC__
+#define XCHG(p, v)      __atomic_exchange_n((p), (v), __ATOMIC_SEQ_CST)
+#define LOAD(p)         __atomic_load_n((p), __ATOMIC_SEQ_CST)
+#define STORE(p, v)     __atomic_store_n((p), (v), __ATOMIC_SEQ_CST)
+#define DEC(p)          __atomic_sub_fetch((p), 1, __ATOMIC_SEQ_CST)
+#else
+#error "br_async.c needs the __atomic builtins (gcc 4.7 or later, or clang)"
+#endif
+
+/*
+ * One transmit thread per port, with a queue for each priority class.
+ *  The queues are intrusive and singly linked, oldest first.  Producers
+ *  swap themselves in at head and then link the old head to themselves;
+ *  only the port's thread looks at tail.  The stubs keep a queue from
+ *  ever being truly empty.
+ *
+ * Each class has at most one part on the go (current) at a time, with its
+ *  place in its plan kept, so whenever a frame is done the thread can go
+ *  on with whichever class is most urgent and come back to the others
+ *  where they left off.
+ */
+
+typedef struct {
+    br_engine *engine;
+    int number;
+    int fd;
+    br_backend *backend;
+    pthread_t thread;
+
+    br_request_part *head[BR_NUM_PRIS];
+    br_request_part *tail[BR_NUM_PRIS];
+    br_request_part stub[BR_NUM_PRIS];
+    br_request_part *current[BR_NUM_PRIS];
+    int streaming;               /* between br_stream_begin() and _end() */
+
+    int waiting;                 /* thread is (about to be) asleep */
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+
+    br_stats stats;              /* as of the last part sent */
+} br_port;
+
+struct br_engine {
+    int numports;
+    br_port ports[BR_MAX_PORTS];
+    unsigned char route[BR_NUM_UNITS];   /* which port each unit is on */
+
+    int running;
+    int quit;
+
+    pthread_mutex_t lock;
+    pthread_cond_t done;         /* for br_wait()ers */
+
+    int notify[2];               /* read, write; the same eventfd on Linux */
+
+    br_port_setup setup;
+    void *setup_arg;
+
+    br_context *ctx;             /* what the ports work in; NULL for the
+                                  *  default */
+};
+
+
+static void stamp(struct timespec *when)
+{
+    br_serial_backend.now(&br_serial_backend, when);
+}
+
+static void push(br_port *port, int pri, br_request_part *part)
+{
+    br_request_part *prev;
+
+
+    STORE(&part->next, NULL);
+    prev = XCHG(&port->head[pri], part);
+
+    /*
+     * Between the exchange and this, the list is briefly broken at prev;
+     *  pop() copes by treating it as empty
+     */
+
+    STORE(&prev->next, part);
+}
+
+static br_request_part *pop(br_port *port, int pri)
+{
+/*
+ * Port's thread only.  Hands back the oldest part of class pri, or NULL
+ *  if there's nothing (finished being) queued.
+ */
+
+    br_request_part *stub = &port->stub[pri];
+    br_request_part *tail = port->tail[pri];
+    br_request_part *next = LOAD(&tail->next);
+
+
+    if (tail == stub) {
+        if (next == NULL)
+            return NULL;
+
+        port->tail[pri] = next;
+        tail = next;
+        next = LOAD(&tail->next);
+    }
+
+    if (next) {
+        port->tail[pri] = next;
+        return tail;
+    }
+
+    if (tail != LOAD(&port->head[pri]))
+        return NULL;        /* someone's halfway through push() */
+
+    /*
+     * tail is the last one; put the stub back behind it so it can go
+     */
+
+    push(port, pri, stub);
+
+    if ((next = LOAD(&tail->next)) != NULL) {
+        port->tail[pri] = next;
+        return tail;
+    }
+
+    return NULL;
+}
+
+static int queued(br_port *port, int upto)
+{
+/*
+ * Is anything more urgent than class upto waiting to be picked up?
+ */
+
+    register int pri;
+
+
+    for (pri = 0; pri < upto; pri++) {
+        if ((port->tail[pri] != &port->stub[pri])
+          || LOAD(&port->stub[pri].next))
+            return 1;
+    }
+
+    return 0;
+}
+
+static br_request_part *pick(br_port *port)
+{
+/*
+ * What to send a frame of next: the most urgent class with anything to
+ *  send, starting on its next part if it's between parts
+ */
+
+    register int pri;
+
+
+    for (pri = 0; pri < BR_NUM_PRIS; pri++) {
+        if (port->current[pri] == NULL)
+            port->current[pri] = pop(port, pri);
+
+        if (port->current[pri])
+            return port->current[pri];
+    }
+
+    return NULL;
+}
+
+static int wait_for_work(br_port *port, int upto,
+  const struct timespec *deadline)
+{
+/*
+ * Sleep until something more urgent than class upto is queued, or until
+ *  the deadline (if there is one).  The waiting flag goes up before the
+ *  queues are checked one last time, and producers check it after
+ *  they've pushed, so one side or the other always sees new work.
+ *
+ * Returns 0 if there's nothing to wait for because it's time to go.
+ */
+
+    int rv = 1;
+
+
+    pthread_mutex_lock(&port->lock);
+    STORE(&port->waiting, 1);
+
+    if (!queued(port, upto)) {
+        if (deadline)
+            pthread_cond_timedwait(&port->wake, &port->lock, deadline);
+        else if (LOAD(&port->engine->quit))
+            rv = 0;
+        else
+            pthread_cond_wait(&port->wake, &port->lock);
+    }
+
+    STORE(&port->waiting, 0);
+    pthread_mutex_unlock(&port->lock);
+
+    return rv;
+}
+
+static void wake_up(br_port *port)
+{
+    if (LOAD(&port->waiting)) {
+        pthread_mutex_lock(&port->lock);
+        pthread_cond_signal(&port->wake);
+        pthread_mutex_unlock(&port->lock);
+    }
+}
+
+static void notify(br_engine *engine)
+{
+#ifdef __linux__
+    uint64_t one = 1;
+#else
+    char one = 1;
+#endif
+
+
+    if (write(engine->notify[1], &one, sizeof(one)) < 0)
+        br_error("br_async", "notify");
+}
+
+static void release(br_request *req)
+{
+    register int i;
+
+
+    if (DEC(&req->refs) > 0)
+        return;
+
+    for (i = 0; i < req->numparts; i++) {
+        if (req->parts[i].cinfo != req->cinfo)
+            br_free_control_info(req->parts[i].cinfo);
+    }
+
+#ifdef MEM_DEBUG
+    printf("br_free_request: Freeing memory at %lx\n", (unsigned long)req);
+#endif
+
+    br_free_control_info(req->cinfo);
+    free(req);
+}
+
+static void finish_part(br_port *port, br_request_part *part, int rv)
+{
+    br_engine *engine = port->engine;
+    br_request *req = part->req;
+    int tmperrno = errno;
+    int last = 0;
+
+
+    port->current[part->priority] = NULL;
+
+    br_free_plan(part->plan);
+    part->plan = NULL;
+
+    pthread_mutex_lock(&port->lock);
+    br_get_stats(&port->stats);
+    pthread_mutex_unlock(&port->lock);
+
+    /*
+     * The last part to finish finishes the request; the first to fail
+     *  says why
+     */
+
+    pthread_mutex_lock(&engine->lock);
+
+    if ((rv < 0) && !req->failed) {
+        req->failed = 1;
+        req->error = tmperrno;
+    }
+
+    if (--req->pending == 0) {
+        stamp(&req->finished);
+        STORE(&req->status, req->failed ? BR_REQ_FAILED:BR_REQ_DONE);
+        pthread_cond_broadcast(&engine->done);
+        last = 1;
+    }
+
+    pthread_mutex_unlock(&engine->lock);
+
+    if (last) {
+        if (req->callback)
+            (*req->callback)(req, req->arg);
+
+        notify(engine);
+    }
+
+    release(req);
+}
+
+static int set_streaming(br_port *port, int stream)
+{
+    int rv;
+
+
+    if (stream == port->streaming)
+        return 0;
+
+    rv = stream ? br_stream_begin(port->fd):br_stream_end(port->fd);
+    port->streaming = stream && (rv == 0);
+
+    return rv;
+}
+
+static int more_work(br_port *port, br_request_part *part)
+{
+/*
+ * Anything to send besides part?
+ */
+
+    register int pri;
+
+
+    for (pri = 0; pri < BR_NUM_PRIS; pri++) {
+        if (port->current[pri] && (port->current[pri] != part))
+            return 1;
+    }
+
+    return queued(port, BR_NUM_PRIS);
+}
+
+static void send_next(br_port *port, br_request_part *part)
+{
+/*
+ * Send one frame of a part.  Frames are as far as preemption goes: once
+ *  one's started, it's sent (hold, bits and all) before anything else
+ *  gets a look in.
+ */
+
+    br_request *req = part->req;
+    const br_frame *frame;
+    struct timespec now;
+    int tmperrno;
+    int rv = 0;
+
+
+    if (part->plan == NULL) {
+        stamp(&now);
+
+        if (XCHG(&req->starting, 1) == 0) {
+            req->started = now;
+            STORE(&req->status, BR_REQ_SENDING);
+        }
+
+        if ((part->plan = br_compile(part->cinfo)) == NULL) {
+            finish_part(port, part, -1);
+            return;
+        }
+
+        br_plan_iter_init(&part->iter, part->plan);
+    }
+
+    if ((frame = br_plan_next(&part->iter)) == NULL) {
+
+        /*
+         * If something else is ready to go, the lines can stay where
+         *  they are for it; otherwise the stream ends here, as it would
+         *  have with br_execute()
+         */
+
+        if (port->streaming && !more_work(port, part))
+            rv = set_streaming(port, 0);
+
+        finish_part(port, part, rv);
+        return;
+    }
+
+    /*
+     * A pause is just time passing, so anything more urgent that turns
+     *  up can have it (see transmit()).  Simulated time doesn't wait for
+     *  anyone, though.
+     */
+
+    if ((frame->cmd == PAUSE)
+      && !(BR_BACKEND->flags & BR_BACKEND_EXACT))
+    {
+        BR_BACKEND->now(BR_BACKEND, &part->pause_until);
+        br_time_add(&part->pause_until, br_cmd_usecs(PAUSE));
+        part->pausing = 1;
+        return;
+    }
+
+    if ((frame->cmd != PAUSE)
+      && (set_streaming(port, part->plan->stream) < 0))
+    {
+        finish_part(port, part, -1);
+        return;
+    }
+
+    br_stream_gap(part->plan->gap);
+
+    if (br_send_frame(port->fd, frame) < 0) {
+        tmperrno = errno;
+        set_streaming(port, 0);
+        errno = tmperrno;
+
+        finish_part(port, part, -1);
+    }
+}
+
+static void transmit(br_port *port)
+{
+/*
+ * Keep sending until it's time to quit and there's nothing left
+ */
+
+    br_request_part *part;
+    struct timespec now;
+
+
+    for (;;) {
+        if ((part = pick(port)) == NULL) {
+            set_streaming(port, 0);
+
+            if (!wait_for_work(port, BR_NUM_PRIS, NULL))
+                return;
+
+            continue;
+        }
+
+        if (part->pausing) {
+            BR_BACKEND->now(BR_BACKEND, &now);
+
+            if (br_time_diff(&part->pause_until, &now) > 0) {
+                wait_for_work(port, part->priority, &part->pause_until);
+                continue;
+            }
+
+            part->pausing = 0;
+        }
+
+        send_next(port, part);
+    }
+}
+
+static void *transmit_thread(void *arg)
+{
+    br_port *port = arg;
+    sigset_t all;
+
+
+    /*
+     * Signals are for the application's threads to deal with
+     */
+
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, NULL);
+
+    br_use_context(port->engine->ctx);
+    br_set_backend(port->backend);
+
+    if (port->engine->setup)
+        (*port->engine->setup)(port->number, port->engine->setup_arg);
+
+    transmit(port);
+
+    return NULL;
+}
+
+static int open_notify(br_engine *engine)
+{
+#ifdef __linux__
+    if ((engine->notify[0] = eventfd(0, EFD_NONBLOCK)) < 0)
+        return -1;
+
+    engine->notify[1] = engine->notify[0];
+#else
+    if (pipe(engine->notify) < 0)
+        return -1;
+
+    fcntl(engine->notify[0], F_SETFL, O_NONBLOCK);
+#endif
+
+    return 0;
+}
+
+static void close_notify(br_engine *engine)
+{
+    close(engine->notify[0]);
+
+    if (engine->notify[1] != engine->notify[0])
+        close(engine->notify[1]);
+}
+
+br_engine *br_new_engine()
+{
+/*
+ * An engine with no ports yet; add them with br_engine_add_port(), say
+ *  which units are where with br_engine_route*(), and br_engine_run().
+ *  Every unit starts out on port 0.
+ */
+
+    br_engine *engine;
+
+
+    if ((engine = malloc(sizeof(br_engine))) == NULL) {
+        br_error("br_new_engine", "malloc");
+        return NULL;
+    }
+
+#ifdef MEM_DEBUG
+    printf("br_new_engine: Malloced %d bytes at %lx\n", sizeof(br_engine),
+      (unsigned long)engine);
+#endif
+
+    memset(engine, 0, sizeof(br_engine));
+
+    if (open_notify(engine) < 0) {
+        br_error("br_new_engine", "eventfd");
+        free(engine);
+        return NULL;
+    }
+
+    pthread_mutex_init(&engine->lock, NULL);
+    pthread_cond_init(&engine->done, NULL);
+
+    /*
+     * The ports send in whatever context the engine was made in, unless
+     *  it's changed before they start
+     */
+
+    engine->ctx = br_current_context;
+
+    return engine;
+}
+
+int br_engine_set_context(br_engine *engine, br_context *ctx)
+{
+    if (engine == NULL) {
+        errno = EINVAL;
+        br_error("br_engine_set_context", "NULL engine pointer");
+        return -1;
+    }
+
+    if (engine->running) {
+        errno = EBUSY;
+        br_error("br_engine_set_context", "Engine already running");
+        return -1;
+    }
+
+    engine->ctx = (ctx == &br_default_context) ? NULL:ctx;
+
+    return 0;
+}
+
+int br_engine_add_port(br_engine *engine, int fd, br_backend *backend)
+{
+/*
+ * Returns the new port's number.  A recording backend (virtual or
+ *  capture) keeps one list of transitions, so each port needs its own.
+ */
+
+    br_port *port;
+    pthread_condattr_t attr;
+    register int i;
+
+
+    if (engine == NULL) {
+        errno = EINVAL;
+        br_error("br_engine_add_port", "NULL engine pointer");
+        return -1;
+    }
+
+    if (engine->running) {
+        errno = EBUSY;
+        br_error("br_engine_add_port", "Engine already running");
+        return -1;
+    }
+
+    if (engine->numports >= BR_MAX_PORTS) {
+        errno = ENOSPC;
+        br_error("br_engine_add_port", "Too many ports");
+        return -1;
+    }
+
+    port = &engine->ports[engine->numports];
+
+    port->engine = engine;
+    port->number = engine->numports;
+    port->fd = fd;
+    port->backend = backend ? backend:br_current_backend;
+    for (i = 0; i < BR_NUM_PRIS; i++) {
+        port->head[i] = &port->stub[i];
+        port->tail[i] = &port->stub[i];
+    }
+
+    /*
+     * Pauses are timed on the serial backend's clock
+     */
+
+    pthread_condattr_init(&attr);
+#ifdef BR_MONOTONIC
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+#endif
+
+    pthread_mutex_init(&port->lock, NULL);
+    pthread_cond_init(&port->wake, &attr);
+    pthread_condattr_destroy(&attr);
+
+    return engine->numports++;
+}
+
+int br_engine_route(br_engine *engine, int unit, int port)
+{
+/*
+ * Send whatever's for unit (housecode << 4 | device) out port
+ */
+
+    if ((engine == NULL) || (unit < 0) || (unit >= BR_NUM_UNITS)
+      || (port < 0) || (port >= engine->numports))
+    {
+        errno = EINVAL;
+        br_error("br_engine_route", "Bad unit or port");
+        return -1;
+    }
+
+    STORE(&engine->route[unit], port);
+
+    return 0;
+}
+
+int br_engine_route_house(br_engine *engine, int house, int port)
+{
+    register int dev;
+
+
+    if ((house < 0) || (house > 15)) {
+        errno = EINVAL;
+        br_error("br_engine_route_house", "Bad housecode");
+        return -1;
+    }
+
+    for (dev = 0; dev < 16; dev++) {
+        if (br_engine_route(engine, BR_UNIT(house, dev), port) < 0)
+            return -1;
+    }
+
+    return 0;
+}
+
+int br_engine_run(br_engine *engine, br_port_setup setup, void *setup_arg)
+{
+/*
+ * Start each port's transmit thread.  setup (if there is one) runs on
+ *  each of them before anything goes out -- the place for things that
+ *  only apply to one thread, like br_rt_enable().
+ */
+
+    register int i;
+
+
+    if ((engine == NULL) || (engine->numports == 0)) {
+        errno = EINVAL;
+        br_error("br_engine_run", "No ports");
+        return -1;
+    }
+
+    if (engine->running) {
+        errno = EBUSY;
+        br_error("br_engine_run", "Engine already running");
+        return -1;
+    }
+
+    engine->setup = setup;
+    engine->setup_arg = setup_arg;
+
+    for (i = 0; i < engine->numports; i++) {
+        if ((errno = pthread_create(&engine->ports[i].thread, NULL,
+          transmit_thread, &engine->ports[i])) != 0)
+        {
+            br_error("br_engine_run", "pthread_create");
+            break;
+        }
+
+        engine->running++;
+    }
+
+    if (engine->running < engine->numports)
+        return -1;
+
+    return 0;
+}
+
+br_engine *br_engine_start(int fd, br_port_setup setup, void *setup_arg)
+{
+/*
+ * The simple case: one port, running right away
+ */
+
+    br_engine *engine;
+    int tmperrno;
+
+
+    if ((engine = br_new_engine()) == NULL)
+        return NULL;
+
+    if ((br_engine_add_port(engine, fd, NULL) < 0)
+      || (br_engine_run(engine, setup, setup_arg) < 0))
+    {
+        tmperrno = errno;
+        br_engine_stop(engine);
+        errno = tmperrno;
+        return NULL;
+    }
+
+    return engine;
+}
+
+int br_engine_stop(br_engine *engine)
+{
+/*
+ * Stop taking requests, send whatever's queued, and clean up.  The
+ *  ports are left open; they're the caller's.  Nobody should still be
+ *  submitting to the engine by the time this returns.
+ */
+
+    br_backend *backend;
+    br_context *ctx;
+    br_port *port;
+    register int i;
+
+
+    if (engine == NULL) {
+        errno = EINVAL;
+        br_error("br_engine_stop", "NULL engine pointer");
+        return -1;
+    }
+
+    STORE(&engine->quit, 1);
+
+    for (i = 0; i < engine->running; i++) {
+        wake_up(&engine->ports[i]);
+        pthread_join(engine->ports[i].thread, NULL);
+    }
+
+    /*
+     * Anything that slipped in while the threads were on their way out
+     *  (or that never had a thread to go to)
+     */
+
+    for (i = 0; i < engine->numports; i++) {
+        port = &engine->ports[i];
+        ctx = br_use_context(engine->ctx);
+        backend = br_set_backend(port->backend);
+        transmit(port);
+        br_set_backend(backend);
+        br_use_context(ctx);
+
+        pthread_mutex_destroy(&port->lock);
+        pthread_cond_destroy(&port->wake);
+    }
+
+    close_notify(engine);
+    pthread_mutex_destroy(&engine->lock);
+    pthread_cond_destroy(&engine->done);
+
+#ifdef MEM_DEBUG
+    printf("br_engine_stop: Freeing memory at %lx\n", (unsigned long)engine);
+#endif
+
+    free(engine);
+
+    return 0;
+}
+
+int br_engine_fd(br_engine *engine)
+{
+/*
+ * Becomes readable whenever a request finishes; see br_engine_reap()
+ */
+
+    if (engine == NULL) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    return engine->notify[0];
+}
+
+int br_engine_reap(br_engine *engine)
+{
+/*
+ * Empty out the descriptor; returns how many requests have finished
+ *  since the last time
+ */
+
+#ifdef __linux__
+    uint64_t count;
+#else
+    char buf[64];
+    int rv;
+#endif
+    int n = 0;
+
+
+    if (engine == NULL) {
+        errno = EINVAL;
+        br_error("br_engine_reap", "NULL engine pointer");
+        return -1;
+    }
+
+#ifdef __linux__
+    if (read(engine->notify[0], &count, sizeof(count)) == sizeof(count))
+        n = count;
+#else
+    while ((rv = read(engine->notify[0], buf, sizeof(buf))) > 0)
+        n += rv;
+#endif
+
+    return n;
+}
+
+int br_engine_get_stats(br_engine *engine, int port, br_stats *copy)
+{
+/*
+ * Each port's thread keeps its own timing statistics (see br_get_stats());
+ *  this is how they looked after the last thing it sent
+ */
+
+    if ((engine == NULL) || (copy == NULL) || (port < 0)
+      || (port >= engine->numports))
+    {
+        errno = EINVAL;
+        br_error("br_engine_get_stats", "Bad engine or port");
+        return -1;
+    }
+
+    pthread_mutex_lock(&engine->ports[port].lock);
+    *copy = engine->ports[port].stats;
+    pthread_mutex_unlock(&engine->ports[port].lock);
+
+    return 0;
+}
+
+static int cmd_ports(br_engine *engine, br_control_info *cinfo, int index)
+{
+/*
+ * Which ports (as a bit mask) a command has to go out.  ON and OFF go
+ *  wherever their units are; the housecode-wide commands go to every
+ *  port with any of that housecode's units on it.  PAUSE goes along with
+ *  everything else, so it's not counted here.
+ */
+
+    br_unit_list *units = cinfo->units[index];
+    int mask = 0;
+    int house;
+    int u;
+
+
+    if (cinfo->cmds[index] == PAUSE)
+        return 0;
+
+    if (units == NULL)
+        return 1;           /* br_compile() will have something to say */
+
+    if (CMDHASDEVS(cinfo->cmds[index])) {
+        for (u = br_us_next(&units->set, -1); u >= 0;
+          u = br_us_next(&units->set, u))
+            mask |= 1 << LOAD(&engine->route[u]);
+
+        return mask;
+    }
+
+    if ((house = br_get_ul_house(units, 0)) < 0)
+        return 1;
+
+    for (u = BR_UNIT(house, 0); u <= BR_UNIT(house, 15); u++)
+        mask |= 1 << LOAD(&engine->route[u]);
+
+    return mask;
+}
+
+static br_control_info *port_control_info(br_engine *engine,
+  br_control_info *cinfo, int port)
+{
+/*
+ * The part of a command list that goes out one port, in the same order,
+ *  so each unit still sees its commands in the order they were given
+ */
+
+    br_control_info *sub;
+    br_unit_list *units;
+    register int i;
+    int u;
+
+
+    if ((sub = br_new_control_info()) == NULL)
+        return NULL;
+
+    sub->inverse = cinfo->inverse;
+    sub->repeat = cinfo->repeat;
+    sub->retx = cinfo->retx;
+    sub->stream = cinfo->stream;
+    sub->priority = cinfo->priority;
+    sub->gap = cinfo->gap;
+
+    for (i = 0; i < cinfo->numcmds; i++) {
+        if ((cinfo->cmds[i] != PAUSE)
+          && !(cmd_ports(engine, cinfo, i) & (1 << port)))
+            continue;
+
+        if ((units = br_new_cmd_unit_list(sub)) == NULL)
+            goto fail;
+
+        if (CMDHASDEVS(cinfo->cmds[i])) {
+            for (u = br_us_next(&cinfo->units[i]->set, -1); u >= 0;
+              u = br_us_next(&cinfo->units[i]->set, u))
+            {
+                if (LOAD(&engine->route[u]) == port)
+                    br_us_add(&units->set, u);
+            }
+
+            units->numunits = br_us_count(&units->set);
+            memcpy(units->last, cinfo->units[i]->last, sizeof(units->last));
+        } else if (cinfo->units[i]) {
+            br_ul_copy(units, cinfo->units[i]);
+        }
+
+        if (br_add_ul_cmd_take(sub, cinfo->cmds[i], units) < 0)
+            goto fail;
+    }
+
+    return sub;
+
+fail:
+    br_free_control_info(sub);
+
+    return NULL;
+}
+
+br_request *br_submit(br_engine *engine, br_control_info *cinfo,
+  br_request_callback callback, void *arg)
+{
+/*
+ * Queue up a command list.  From here on cinfo belongs to the request
+ *  (unless this fails); the request itself is the caller's to
+ *  br_free_request() whenever it's done with it, before or after it's
+ *  been sent.
+ *
+ * With more than one port, the list is split up by where its units are
+ *  routed and each port sends its share at the same time as the others.
+ *  On each port, frames of more urgent lists (see cinfo->priority) cut in
+ *  ahead of less urgent ones between frames.
+ */
+
+    br_request *req;
+    br_request_part *part;
+    int ports = 0;
+    int numparts = 0;
+    int pri;
+    register int i;
+
+
+    if ((engine == NULL) || (cinfo == NULL)) {
+        errno = EINVAL;
+        br_error("br_submit", "NULL pointer");
+        return NULL;
+    }
+
+    if (LOAD(&engine->quit) || (engine->numports == 0)) {
+        errno = EPIPE;
+        br_error("br_submit", "Engine stopped");
+        return NULL;
+    }
+
+    pri = cinfo->priority;
+
+    if ((pri < 0) || (pri >= BR_NUM_PRIS))
+        pri = BR_PRI_BULK;
+
+    if (engine->numports > 1) {
+        for (i = 0; i < cinfo->numcmds; i++)
+            ports |= cmd_ports(engine, cinfo, i);
+    }
+
+    if (ports == 0)
+        ports = 1;
+
+    for (i = 0; i < engine->numports; i++) {
+        if (ports & (1 << i))
+            numparts++;
+    }
+
+    req = malloc(sizeof(br_request) + (numparts - 1) * sizeof(br_request_part));
+
+    if (req == NULL) {
+        br_error("br_submit", "malloc");
+        return NULL;
+    }
+
+#ifdef MEM_DEBUG
+    printf("br_submit: Malloced %d bytes at %lx\n",
+      sizeof(br_request) + (numparts - 1) * sizeof(br_request_part),
+      (unsigned long)req);
+#endif
+
+    memset(req, 0, sizeof(br_request));
+
+    req->engine = engine;
+    req->cinfo = cinfo;
+    req->callback = callback;
+    req->arg = arg;
+    req->status = BR_REQ_QUEUED;
+    req->refs = numparts + 2;       /* and one for us till it's queued */
+    req->pending = numparts;
+
+    for (i = 0; i < engine->numports; i++) {
+        if (!(ports & (1 << i)))
+            continue;
+
+        part = &req->parts[req->numparts];
+        part->req = req;
+        part->port = i;
+        part->priority = pri;
+
+        if (numparts == 1) {
+            part->cinfo = cinfo;
+        } else if ((part->cinfo = port_control_info(engine, cinfo, i))
+          == NULL)
+        {
+            req->cinfo = NULL;          /* still the caller's */
+            req->refs = 1;
+            release(req);
+            return NULL;
+        }
+
+        req->numparts++;
+    }
+
+    stamp(&req->submitted);
+
+    for (i = 0; i < req->numparts; i++) {
+        part = &req->parts[i];
+        push(&engine->ports[part->port], pri, part);
+        wake_up(&engine->ports[part->port]);
+    }
+
+    release(req);
+
+    return req;
+}
+
+br_request *br_submit_cmd(br_engine *engine, int cmd, int house, int dev,
+  br_request_callback callback, void *arg)
+{
+    br_control_info *cinfo;
+    br_request *req;
+
+
+    if ((cinfo = br_new_control_info()) == NULL)
+        return NULL;
+
+    if ((br_add_cmd(cinfo, cmd, house, dev) < 0)
+      || ((req = br_submit(engine, cinfo, callback, arg)) == NULL))
+    {
+        br_free_control_info(cinfo);
+        return NULL;
+    }
+
+    return req;
+}
+
+int br_request_status(br_request *req)
+{
+    if (req == NULL) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    return LOAD(&req->status);
+}
+
+int br_wait(br_request *req, long usecs)
+{
+/*
+ * Wait for a request to finish, for up to usecs (-1 is forever).
+ *  Returns what br_execute() would have, with errno to match, or -1
+ *  with errno ETIMEDOUT if time ran out first.
+ */
+
+    br_engine *engine;
+    struct timeval now;
+    struct timespec deadline;
+    int rv = 0;
+
+
+    if (req == NULL) {
+        errno = EINVAL;
+        br_error("br_wait", "NULL request pointer");
+        return -1;
+    }
+
+    if (LOAD(&req->status) < BR_REQ_DONE) {
+        engine = req->engine;
+
+        if (usecs >= 0) {
+            gettimeofday(&now, NULL);
+            deadline.tv_sec = now.tv_sec;
+            deadline.tv_nsec = now.tv_usec * 1000;
+            br_time_add(&deadline, usecs);
+        }
+
+        pthread_mutex_lock(&engine->lock);
+
+        while ((LOAD(&req->status) < BR_REQ_DONE) && (rv == 0)) {
+            if (usecs < 0)
+                rv = pthread_cond_wait(&engine->done, &engine->lock);
+            else
+                rv = pthread_cond_timedwait(&engine->done, &engine->lock,
+                  &deadline);
+        }
+
+        pthread_mutex_unlock(&engine->lock);
+
+        if (LOAD(&req->status) < BR_REQ_DONE) {
+            errno = ETIMEDOUT;
+            return -1;
+        }
+    }
+
+    if (req->status == BR_REQ_FAILED) {
+        errno = req->error;
+        return -1;
+    }
+
+    return 0;
+}
+
+int br_free_request(br_request *req)
+{
+    if (req == NULL) {
+        errno = EINVAL;
+        br_error("br_free_request", "NULL request pointer");
+        return -1;
+    }
+
+    release(req);
+
+    return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,121 @@
+#ifndef _BR_ASYNC_H
+#define _BR_ASYNC_H
+
+/*
+ * br_async.h -- Sending without waiting: command lists are submitted to
+ *               an engine, whose own threads (one per port) are the only
+ *               things that ever touch the ports, and the submitter hears
+ *               back through a callback, a pollable descriptor or
+ *               br_wait().  More urgent lists cut in at frame boundaries.
+ *
+ * (c) 1999 Tymm Twillman (tymm@acm.org)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <time.h>
+
+#include "br_cmd.h"
+#include "br_cmd_engine.h"
+#include "br_plan.h"
+#include "br_backend.h"
+
+#define BR_MAX_PORTS 16
+
+/*
+ * Where a request is at
+ */
+
+#define BR_REQ_QUEUED   0
+#define BR_REQ_SENDING  1
+#define BR_REQ_DONE     2      /* went out fine */
+#define BR_REQ_FAILED   3      /* see error */
+
+typedef struct br_engine br_engine;
+
+/*
+ * What one port has to send for a request.  A request whose units are
+ *  all on one port has one part, sending the request's own command list;
+ *  otherwise each port involved gets its own part of the list.
+ */
+
+typedef struct br_request_part {
+    struct br_request_part *next;     /* port's queue link */
+    struct br_request *req;
+    br_control_info *cinfo;
+    int port;
+    int priority;
+    br_plan *plan;                    /* while it's being sent */
+    br_plan_iter iter;                /* how far it's got */
+    int pausing;
+    struct timespec pause_until;
+} br_request_part;
+
+typedef struct br_request {
+    br_engine *engine;
+    br_control_info *cinfo;           /* belongs to the request */
+    void (*callback)(struct br_request *, void *);
+    void *arg;
+    int status;                       /* BR_REQ_*; see br_request_status() */
+    int error;                        /* errno, if it failed */
+    struct timespec submitted;        /* monotonic, like the serial backend */
+    struct timespec started;          /* when the first part started */
+    struct timespec finished;         /* when the last part finished */
+
+    /*
+     * The engine's business
+     */
+
+    int refs;                         /* submitter's + one per part */
+    int starting;
+    int pending;                      /* parts still to finish */
+    int failed;
+    int numparts;
+    br_request_part parts[1];         /* really numparts of them */
+} br_request;
+
+/*
+ * The callback runs on the engine's thread when a request is finished,
+ *  so it should be quick about it.  It's fine for it to br_free_request()
+ *  the request it's handed.
+ */
+
+typedef void (*br_request_callback)(br_request *, void * /* arg */);
+typedef void (*br_port_setup)(int /* port */, void * /* arg */);
+
+br_engine *br_new_engine();
+int br_engine_set_context(br_engine *, br_context *);
+int br_engine_add_port(br_engine *, int /* file desc */,
+              br_backend * /* NULL for the current one */);
+int br_engine_route(br_engine *, int /* unit */, int /* port */);
+int br_engine_route_house(br_engine *, int /* house */, int /* port */);
+int br_engine_run(br_engine *, br_port_setup, void * /* setup arg */);
+br_engine *br_engine_start(int /* file desc */, br_port_setup,
+              void * /* setup arg */);
+int br_engine_stop(br_engine *);
+int br_engine_fd(br_engine *);
+int br_engine_reap(br_engine *);
+int br_engine_get_stats(br_engine *, int /* port */, br_stats *);
+
+br_request *br_submit(br_engine *, br_control_info *, br_request_callback,
+              void * /* callback arg */);
+br_request *br_submit_cmd(br_engine *, int /* cmd */, int /* house */,
+              int /* dev */, br_request_callback, void * /* callback arg */);
+int br_request_status(br_request *);
+int br_wait(br_request *, long /* timeout in uSec, or -1 */);
+int br_free_request(br_request *);
+
+#endif
@@ -0,0 +1,447 @@
+/*
+ * br_backend.c -- Backends for BottleRocket's frame output: the real
+ *  serial port, and a virtual one for running the engine without one.
+ *  (c) 1999 by Tymm Twillman (tymm@acm.org).
+ *
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ */
+
+#ifdef __cplusplus
+extern C {
+#endif
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/time.h>
+#include <time.h>
+
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#else
+extern int errno;
+#endif
+
+#ifdef HAVE_SYS_TERMIOS_H
+#include <sys/termios.h>
+#endif
+
+#ifdef HAVE_TERMIOS_H
+#include <termios.h>
+#endif
+
+#include "br_cmd.h"
+#include "br_backend.h"
+
+#define TRANSITION_BLKSIZE 1024   /* virtual line changes allocated at a time */
+
+
+void br_time_add(struct timespec *t, long usecs)
+{
+    t->tv_sec += usecs / 1000000;
+    t->tv_nsec += (usecs % 1000000) * 1000;
+
+    if (t->tv_nsec >= 1000000000) {
+        t->tv_sec++;
+        t->tv_nsec -= 1000000000;
+    } else if (t->tv_nsec < 0) {
+        t->tv_sec--;
+        t->tv_nsec += 1000000000;
+    }
+}
+
+long br_time_diff(const struct timespec *a, const struct timespec *b)
+{
+    /*
+     * a - b, in uSec
+     */
+
+    return (a->tv_sec - b->tv_sec) * 1000000L
+      + (a->tv_nsec - b->tv_nsec) / 1000;
+}
+
+/*
+ * The serial port.  Where there's no monotonic clock we fall back to
+ *  gettimeofday() and select(), which works as well as it always did.
+ */
+
+static int serial_set_lines(br_backend *backend, int fd, int lines)
+{
+    return ioctl(fd, TIOCMBIS, &lines);
+}
+
+static int serial_clear_lines(br_backend *backend, int fd, int lines)
+{
+    return ioctl(fd, TIOCMBIC, &lines);
+}
+
+static int serial_get_lines(br_backend *backend, int fd, int *lines)
+{
+    return ioctl(fd, TIOCMGET, lines);
+}
+
+static int serial_put_lines(br_backend *backend, int fd, int lines)
+{
+    return ioctl(fd, TIOCMSET, &lines);
+}
+
+static int serial_now(br_backend *backend, struct timespec *now)
+{
+#ifdef BR_MONOTONIC
+    return clock_gettime(CLOCK_MONOTONIC, now);
+#else
+    struct timeval tv;
+
+
+    if (gettimeofday(&tv, NULL) < 0)
+        return -1;
+
+    now->tv_sec = tv.tv_sec;
+    now->tv_nsec = tv.tv_usec * 1000;
+
+    return 0;
+#endif
+}
+
+static int serial_sleep_until(br_backend *backend,
+  const struct timespec *deadline)
+{
+#ifdef BR_MONOTONIC
+    int rv;
+
+
+    while ((rv = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, deadline,
+      NULL)) == EINTR)
+        ;
+
+    if (rv != 0) {
+        errno = rv;
+        return -1;
+    }
+#else
+    struct timespec now;
+    struct timeval sleeptime;
+    long usecs;
+
+
+    if (serial_now(backend, &now) < 0)
+        return -1;
+
+    if ((usecs = br_time_diff(deadline, &now)) <= 0)
+        return 0;
+
+    sleeptime.tv_sec = usecs / 1000000;
+    sleeptime.tv_usec = usecs % 1000000;
+
+    if (select(0, NULL, NULL, NULL, &sleeptime) < 0)
+        return -1;
+#endif
+
+    return 0;
+}
+
+br_backend br_serial_backend = {
+    "serial",
+    BR_BACKEND_PORT,
+    serial_set_lines,
+    serial_clear_lines,
+    serial_get_lines,
+    serial_put_lines,
+    serial_now,
+    serial_sleep_until,
+    NULL
+};
+
+BR_THREAD br_backend *br_current_backend = NULL;
+
+br_backend *br_set_backend(br_backend *backend)
+{
+    /*
+     * Returns the backend this thread had set before (NULL if it was
+     *  going by its context), to hand back here when done
+     */
+
+    br_backend *old = br_current_backend;
+
+
+    br_current_backend = backend;
+
+    return old;
+}
+
+/*
+ * The virtual backend.  Time only moves when someone sleeps (or changes
+ *  the lines, if line_usecs is set), so a plan that would take a quarter
+ *  of an hour on the air runs as fast as the CPU allows.
+ */
+
+static int virtual_record(br_virtual *v)
+{
+    br_transition *tmp;
+
+
+    if (v->inner) {
+        if (v->inner->now(v->inner, &v->clock) < 0)
+            return -1;
+    } else if (v->line_usecs) {
+        br_time_add(&v->clock, v->line_usecs);
+    }
+
+    if (!v->record)
+        return 0;
+
+    if (v->numtransitions >= v->allocatedtransitions) {
+        tmp = realloc(v->transitions, (v->allocatedtransitions
+          + TRANSITION_BLKSIZE) * sizeof(br_transition));
+
+        if (tmp == NULL)
+            return -1;
+
+        v->transitions = tmp;
+        v->allocatedtransitions += TRANSITION_BLKSIZE;
+    }
+
+    v->transitions[v->numtransitions].when = br_time_diff(&v->clock, &v->start);
+    v->transitions[v->numtransitions].lines = v->lines;
+    v->numtransitions++;
+
+    return 0;
+}
+
+static int virtual_set_lines(br_backend *backend, int fd, int lines)
+{
+    br_virtual *v = backend->priv;
+
+
+    if (v->inner && (v->inner->set_lines(v->inner, fd, lines) < 0))
+        return -1;
+
+    v->lines |= lines;
+
+    return virtual_record(v);
+}
+
+static int virtual_clear_lines(br_backend *backend, int fd, int lines)
+{
+    br_virtual *v = backend->priv;
+
+
+    if (v->inner && (v->inner->clear_lines(v->inner, fd, lines) < 0))
+        return -1;
+
+    v->lines &= ~lines;
+
+    return virtual_record(v);
+}
+
+static int virtual_put_lines(br_backend *backend, int fd, int lines)
+{
+    br_virtual *v = backend->priv;
+    br_backend *inner = v->inner;
+
+
+    if (inner) {
+        if (inner->put_lines) {
+            if (inner->put_lines(inner, fd, lines) < 0)
+                return -1;
+        } else if ((inner->set_lines(inner, fd, lines & ~v->lines) < 0)
+          || (inner->clear_lines(inner, fd, v->lines & ~lines) < 0)) {
+            return -1;
+        }
+    }
+
+    v->lines = lines;
+
+    return virtual_record(v);
+}
+
+static int virtual_get_lines(br_backend *backend, int fd, int *lines)
+{
+    br_virtual *v = backend->priv;
+
+
+    if (v->inner) {
+        if (v->inner->get_lines(v->inner, fd, lines) < 0)
+            return -1;
+
+        v->lines = *lines;
+
+        return 0;
+    }
+
+    *lines = v->lines;
+
+    return 0;
+}
+
+static int virtual_now(br_backend *backend, struct timespec *now)
+{
+    br_virtual *v = backend->priv;
+
+
+    if (v->inner)
+        return v->inner->now(v->inner, now);
+
+    *now = v->clock;
+
+    return 0;
+}
+
+static int virtual_sleep_until(br_backend *backend,
+  const struct timespec *deadline)
+{
+    br_virtual *v = backend->priv;
+
+
+    if (v->inner)
+        return v->inner->sleep_until(v->inner, deadline);
+
+    if (br_time_diff(deadline, &v->clock) > 0)
+        v->clock = *deadline;
+
+    return 0;
+}
+
+static br_backend *new_backend(br_backend *inner)
+{
+    /*
+     * Without an inner backend, this is the virtual one
+     */
+
+    br_backend *backend;
+    br_virtual *v;
+
+
+    backend = malloc(sizeof(br_backend) + sizeof(br_virtual));
+
+    if (backend == NULL) {
+        br_error("new_backend", "malloc");
+        return NULL;
+    }
+
+    v = (br_virtual *)(backend + 1);
+    memset(v, 0, sizeof(br_virtual));
+
+    v->inner = inner;
+    v->record = 1;
+
+    if (inner) {
+        if (inner->now(inner, &v->clock) < 0) {
+            br_error("new_backend", "clock");
+            free(backend);
+            return NULL;
+        }
+    } else {
+        /*
+         * Start off somewhere that isn't zero, so nothing mistakes the
+         *  virtual clock for one that was never set
+         */
+
+        v->clock.tv_sec = 1;
+    }
+
+    v->start = v->clock;
+
+    backend->name = inner ? "capture":"virtual";
+    backend->flags = inner ? inner->flags:BR_BACKEND_EXACT;
+    backend->set_lines = virtual_set_lines;
+    backend->clear_lines = virtual_clear_lines;
+    backend->get_lines = virtual_get_lines;
+    backend->put_lines = virtual_put_lines;
+    backend->now = virtual_now;
+    backend->sleep_until = virtual_sleep_until;
+    backend->priv = v;
+
+    return backend;
+}
+
+br_backend *br_new_virtual_backend()
+{
+    return new_backend(NULL);
+}
+
+br_backend *br_new_capture_backend(br_backend *inner)
+{
+    return new_backend(inner ? inner:&br_serial_backend);
+}
+
+int br_free_virtual_backend(br_backend *backend)
+{
+    if (backend == NULL)
+        return 0;
+
+    if (br_current_backend == backend)
+        br_set_backend(NULL);
+
+    /*
+     * Whatever's cached about its lines goes with it
+     */
+
+    br_forget_lines(-1);
+
+    free(((br_virtual *)backend->priv)->transitions);
+    free(backend);
+
+    return 0;
+}
+
+int br_virtual_reset(br_backend *backend)
+{
+    /*
+     * Forget what's been recorded (but hang on to the memory) and start
+     *  timing from now
+     */
+
+    br_virtual *v = backend->priv;
+
+
+    if (v->inner && (v->inner->now(v->inner, &v->clock) < 0))
+        return -1;
+
+    v->numtransitions = 0;
+    v->start = v->clock;
+
+    return 0;
+}
+
+br_virtual *br_virtual_state(br_backend *backend)
+{
+    return backend->priv;
+}
+
+long br_virtual_elapsed(br_backend *backend)
+{
+    br_virtual *v = backend->priv;
+
+
+    if (v->inner)
+        v->inner->now(v->inner, &v->clock);
+
+    return br_time_diff(&v->clock, &v->start);
+}
+
+#ifdef __cplusplus
+}
+#endif
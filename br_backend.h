@@ -0,0 +1,133 @@
+#ifndef _BR_BACKEND_H
+#define _BR_BACKEND_H
+
+/*
+ * br_backend.h -- What br_cmd() wiggles lines and keeps time with.  The
+ *                 serial port is the usual one; the virtual backend
+ *                 just records what would have happened, on a clock
+ *                 that doesn't actually wait for anything.
+ *
+ * (c) 1999 Tymm Twillman (tymm@acm.org)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <sys/types.h>
+#include <sys/ioctl.h>
+#include <time.h>
+
+#include "br_cmd.h"
+
+/*
+ * The serial backend's clock: monotonic wherever there's one to be had
+ */
+
+#if defined(CLOCK_MONOTONIC) && defined(TIMER_ABSTIME)
+#define BR_MONOTONIC
+#endif
+
+/*
+ * Which lines carry which bits
+ */
+
+#ifndef TIOCM_FOR_0
+#define TIOCM_FOR_0 TIOCM_DTR
+#endif
+
+#ifndef TIOCM_FOR_1
+#define TIOCM_FOR_1 TIOCM_RTS
+#endif
+
+#define BR_BACKEND_EXACT   0x01   /* sleeps are exact; no need to spin */
+#define BR_BACKEND_PORT    0x02   /* fd is a real serial port (termios) */
+
+typedef struct br_backend {
+    char *name;
+    int flags;
+
+    /*
+     * Line operations take and return TIOCM_* bits, like the ioctls.
+     *  put_lines() sets every line at once (TIOCMSET); a backend without
+     *  one gets by with set_lines() and clear_lines().
+     */
+
+    int (*set_lines)(struct br_backend *, int /* fd */, int /* lines */);
+    int (*clear_lines)(struct br_backend *, int /* fd */, int /* lines */);
+    int (*get_lines)(struct br_backend *, int /* fd */, int * /* lines */);
+    int (*put_lines)(struct br_backend *, int /* fd */, int /* lines */);
+
+    /*
+     * Timekeeping; now() should be monotonic
+     */
+
+    int (*now)(struct br_backend *, struct timespec *);
+    int (*sleep_until)(struct br_backend *, const struct timespec *);
+
+    void *priv;
+} br_backend;
+
+extern br_backend br_serial_backend;
+extern BR_THREAD br_backend *br_current_backend;
+
+/*
+ * The backend this thread sends with: its own if it's set one, otherwise
+ *  its context's, otherwise the serial port
+ */
+
+#define BR_BACKEND  (br_current_backend ? br_current_backend \
+          :BR_CTX->backend ? BR_CTX->backend:&br_serial_backend)
+
+br_backend *br_set_backend(br_backend * /* NULL for the context's */);
+
+/*
+ * The virtual backend keeps every line change, timed in uSec from when
+ *  it was created (or last reset).  A capture backend does the same
+ *  while passing everything through to another backend (usually the
+ *  serial one), timed by that backend's clock.
+ */
+
+typedef struct {
+    long when;
+    int lines;
+} br_transition;
+
+typedef struct {
+    struct timespec clock;
+    struct timespec start;
+    int lines;
+    long line_usecs;             /* pretend each line change takes this long */
+    int record;                  /* keep transitions? */
+    int numtransitions;
+    int allocatedtransitions;
+    br_transition *transitions;
+    br_backend *inner;           /* what a capture backend passes on to */
+} br_virtual;
+
+br_backend *br_new_virtual_backend();
+br_backend *br_new_capture_backend(br_backend * /* NULL for serial */);
+int br_free_virtual_backend(br_backend *);
+int br_virtual_reset(br_backend *);
+br_virtual *br_virtual_state(br_backend *);
+long br_virtual_elapsed(br_backend *);
+
+/*
+ * Handy for anyone else doing arithmetic on timespecs
+ */
+
+void br_time_add(struct timespec *, long /* usecs */);
+long br_time_diff(const struct timespec *, const struct timespec *);
+
+#endif
@@ -0,0 +1,708 @@
+/*
+ * br_bench.c -- Throughput and allocation benchmarks for the command
+ *  engine: parsing unit lists, building and tearing down command lists,
+ *  compiling plans, running them on the virtual backend and decoding
+ *  the result (which has to round-trip exactly).  Results go to stdout
+ *  as JSON, so runs from different versions can be compared.
+ *  (c) 1999 by Tymm Twillman (tymm@acm.org).
+ *
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU General Public License
+ *   as published by the Free Software Foundation; either version 2
+ *   of the License, or (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <time.h>
+
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#endif
+
+#include "br_cmd.h"
+#include "br_cmd_engine.h"
+#include "br_plan.h"
+#include "br_backend.h"
+#include "br_decode.h"
+
+/*
+ * Allocations are counted by wrapping malloc() and friends at link time
+ *  (see the bench target in the Makefile), so the library itself doesn't
+ *  need to know it's being watched.  Only allocations made while a
+ *  benchmark's clock is running are counted.
+ */
+
+void *__real_malloc(size_t);
+void *__real_calloc(size_t, size_t);
+void *__real_realloc(void *, size_t);
+void __real_free(void *);
+
+static int counting = 0;
+static long num_allocs;
+static long num_bytes;
+static long num_frees;
+
+void *__wrap_malloc(size_t size)
+{
+    if (counting) {
+        num_allocs++;
+        num_bytes += size;
+    }
+
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t n, size_t size)
+{
+    if (counting) {
+        num_allocs++;
+        num_bytes += n * size;
+    }
+
+    return __real_calloc(n, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+    if (counting) {
+        num_allocs++;
+        num_bytes += size;
+    }
+
+    return __real_realloc(ptr, size);
+}
+
+void __wrap_free(void *ptr)
+{
+    if (counting && ptr)
+        num_frees++;
+
+    __real_free(ptr);
+}
+
+/*
+ * Timing; each benchmark brackets the part worth measuring with
+ *  bench_start() and bench_stop(), as many times as it likes
+ */
+
+static struct timespec started;
+static long elapsed_nsecs;
+
+static void bench_start()
+{
+    clock_gettime(CLOCK_MONOTONIC, &started);
+    counting = 1;
+}
+
+static void bench_stop()
+{
+    struct timespec now;
+
+
+    counting = 0;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    elapsed_nsecs += (now.tv_sec - started.tv_sec) * 1000000000L
+      + (now.tv_nsec - started.tv_nsec);
+}
+
+#define NUM_CMDS      5000      /* commands in a "large" control info */
+#define CMD_UNITS     16        /* units per command in it */
+#define LIST_UNITS    4096      /* units in a "large" unit list */
+
+static br_unit_list *make_units(int numunits)
+{
+    /*
+     * A list cycling through every house and device
+     */
+
+    br_unit_list *units;
+    register int i;
+
+
+    if ((units = br_new_unit_list()) == NULL)
+        exit(errno);
+
+    for (i = 0; i < numunits; i++) {
+        if (br_add_unit(units, (i / 16) % 16, i % 16) < 0)
+            exit(errno);
+    }
+
+    return units;
+}
+
+static br_control_info *make_cinfo(int numcmds, int cmdunits)
+{
+    br_control_info *cinfo;
+    br_unit_list *units;
+    register int i;
+
+
+    if ((cinfo = br_new_control_info()) == NULL)
+        exit(errno);
+
+    units = make_units(cmdunits);
+
+    for (i = 0; i < numcmds; i++) {
+        if (br_add_ul_cmd(cinfo, (i & 1) ? OFF:ON, units) < 0)
+            exit(errno);
+    }
+
+    br_free_unit_list(units);
+
+    return cinfo;
+}
+
+/*
+ * The benchmarks.  Each returns how many "items" (units, commands,
+ *  frames...) it got through, for the throughput figures.
+ */
+
+static long bench_strtoul(int iterations)
+{
+    char *str;
+    char *p;
+    char *endptr;
+    br_unit_list *units;
+    register int i;
+
+
+    /*
+     * "A1,A2,...,A16,B1,..." over and over, LIST_UNITS units long
+     */
+
+    if ((str = malloc(LIST_UNITS * 5 + 1)) == NULL)
+        exit(errno);
+
+    for (p = str, i = 0; i < LIST_UNITS; i++) {
+        p += sprintf(p, "%s%c%d", i ? ",":"", 'A' + (i / 16) % 16,
+          i % 16 + 1);
+    }
+
+    if ((units = br_new_unit_list()) == NULL)
+        exit(errno);
+
+    for (i = 0; i < iterations; i++) {
+        bench_start();
+
+        if (br_strtoul(str, units, &endptr) < 0)
+            exit(errno);
+
+        bench_stop();
+    }
+
+    br_free_unit_list(units);
+    free(str);
+
+    return (long)iterations * LIST_UNITS;
+}
+
+static long bench_add_unit(int iterations)
+{
+    br_unit_list *units;
+    register int i;
+    register int j;
+
+
+    for (i = 0; i < iterations; i++) {
+        if ((units = br_new_unit_list()) == NULL)
+            exit(errno);
+
+        bench_start();
+
+        for (j = 0; j < LIST_UNITS; j++) {
+            if (br_add_unit(units, (j / 16) % 16, j % 16) < 0)
+                exit(errno);
+        }
+
+        bench_stop();
+
+        br_free_unit_list(units);
+    }
+
+    return (long)iterations * LIST_UNITS;
+}
+
+static long bench_uldup(int iterations)
+{
+    br_unit_list *units;
+    br_unit_list *dup;
+    register int i;
+
+
+    units = make_units(256);
+
+    for (i = 0; i < iterations; i++) {
+        bench_start();
+
+        if ((dup = br_uldup(units)) == NULL)
+            exit(errno);
+
+        bench_stop();
+
+        br_free_unit_list(dup);
+    }
+
+    br_free_unit_list(units);
+
+    return iterations;
+}
+
+static long bench_add_ul_cmd(int iterations)
+{
+    br_control_info *cinfo;
+    br_unit_list *units;
+    register int i;
+    register int j;
+
+
+    units = make_units(CMD_UNITS);
+
+    for (i = 0; i < iterations; i++) {
+        if ((cinfo = br_new_control_info()) == NULL)
+            exit(errno);
+
+        bench_start();
+
+        for (j = 0; j < NUM_CMDS; j++) {
+            if (br_add_ul_cmd(cinfo, (j & 1) ? OFF:ON, units) < 0)
+                exit(errno);
+        }
+
+        bench_stop();
+
+        br_free_control_info(cinfo);
+    }
+
+    br_free_unit_list(units);
+
+    return (long)iterations * NUM_CMDS;
+}
+
+static long bench_add_cmd_reuse(int iterations)
+{
+    /*
+     * Steady state for something like brd: one control info, filled and
+     *  emptied over and over.  Once its arena has grown to fit, this
+     *  shouldn't allocate anything.
+     */
+
+    br_control_info *cinfo;
+    register int i;
+    register int j;
+
+
+    if ((cinfo = br_new_control_info()) == NULL)
+        exit(errno);
+
+    for (i = 0; i < iterations; i++) {
+        bench_start();
+
+        for (j = 0; j < NUM_CMDS; j++) {
+            if (br_add_cmd(cinfo, (j & 1) ? OFF:ON, (j / 16) % 16, j % 16) < 0)
+                exit(errno);
+        }
+
+        br_free_cmds(cinfo);
+
+        bench_stop();
+    }
+
+    br_free_control_info(cinfo);
+
+    return (long)iterations * NUM_CMDS;
+}
+
+static long bench_del_unit(int iterations)
+{
+    br_unit_list *units;
+    register int i;
+    register int j;
+
+
+    /*
+     * Take every house/device pair out one at a time.  0 matches anything
+     *  to br_del_unit(), so pairs with a 0 in them go last, all at once.
+     *  (Lists used to keep duplicates, so this was LIST_UNITS entries
+     *  long; it's 256 now.)
+     */
+
+    for (i = 0; i < iterations; i++) {
+        units = make_units(LIST_UNITS);
+
+        bench_start();
+
+        for (j = 0; j < 256; j++) {
+            if ((j / 16) && (j % 16) && (br_del_unit(units, j / 16, j % 16) < 0))
+                exit(errno);
+        }
+
+        if (br_del_unit(units, 0, 0) < 0)
+            exit(errno);
+
+        bench_stop();
+
+        br_free_unit_list(units);
+    }
+
+    return (long)iterations * BR_NUM_UNITS;
+}
+
+static long bench_unit_sets(int iterations)
+{
+    /*
+     * Set operations on unit lists: a union, an intersection and a
+     *  difference of two half-full sets, counted and walked through
+     */
+
+    br_unit_set a;
+    br_unit_set b;
+    br_unit_set c;
+    register int i;
+    int u;
+    long items = 0;
+    volatile int sink = 0;
+
+
+    br_us_clear(&a);
+    br_us_clear(&b);
+
+    for (u = 0; u < BR_NUM_UNITS; u++) {
+        if (u % 2)
+            br_us_add(&a, u);
+
+        if (u % 3)
+            br_us_add(&b, u);
+    }
+
+    bench_start();
+
+    for (i = 0; i < iterations; i++) {
+        br_us_union(&c, &a, &b);
+        sink += br_us_count(&c);
+        br_us_intersect(&c, &a, &b);
+        sink += br_us_count(&c);
+        br_us_diff(&c, &a, &b);
+
+        for (u = br_us_next(&c, -1); u >= 0; u = br_us_next(&c, u))
+            items++;
+    }
+
+    bench_stop();
+
+    return items;
+}
+
+static long bench_del_cmd(int iterations)
+{
+    br_control_info *cinfo;
+    register int i;
+
+
+    for (i = 0; i < iterations; i++) {
+        cinfo = make_cinfo(NUM_CMDS, CMD_UNITS);
+
+        bench_start();
+
+        while (br_get_num_commands(cinfo)) {
+            if (br_del_cmd(cinfo, 0) < 0)
+                exit(errno);
+        }
+
+        bench_stop();
+
+        br_free_control_info(cinfo);
+    }
+
+    return (long)iterations * NUM_CMDS;
+}
+
+static long bench_compile(int iterations)
+{
+    br_control_info *cinfo;
+    br_plan *plan;
+    register int i;
+    long items = 0;
+
+
+    cinfo = make_cinfo(NUM_CMDS, CMD_UNITS);
+
+    for (i = 0; i < iterations; i++) {
+        bench_start();
+
+        if ((plan = br_compile(cinfo)) == NULL)
+            exit(errno);
+
+        bench_stop();
+
+        items += plan->numframes;
+        br_free_plan(plan);
+    }
+
+    br_free_control_info(cinfo);
+
+    return items;
+}
+
+static long bench_execute(int iterations, int stream)
+{
+    br_control_info *cinfo;
+    br_backend *backend;
+    register int i;
+
+
+    /*
+     * The whole br_execute(), compile and all, with the waiting done on
+     *  the virtual clock.  Transitions aren't kept; we're timing the
+     *  engine, not the recorder.
+     */
+
+    cinfo = make_cinfo(NUM_CMDS / 10, CMD_UNITS);
+    cinfo->stream = stream;
+
+    if ((backend = br_new_virtual_backend()) == NULL)
+        exit(errno);
+
+    br_virtual_state(backend)->record = 0;
+    br_set_backend(backend);
+
+    for (i = 0; i < iterations; i++) {
+        bench_start();
+
+        if (br_execute(-1, cinfo) < 0)
+            exit(errno);
+
+        bench_stop();
+    }
+
+    br_free_virtual_backend(backend);
+    br_free_control_info(cinfo);
+
+    return (long)iterations * (NUM_CMDS / 10) * CMD_UNITS;
+}
+
+static long bench_execute_normal(int iterations)
+{
+    return bench_execute(iterations, 0);
+}
+
+static long bench_execute_stream(int iterations)
+{
+    return bench_execute(iterations, 1);
+}
+
+static br_control_info *make_every_cinfo()
+{
+    /*
+     * Every encoding br_compile() can produce: ON and OFF for each unit,
+     *  and each of the per-housecode commands for each housecode
+     */
+
+    br_control_info *cinfo;
+    register int house;
+    register int dev;
+    register int cmd;
+
+
+    if ((cinfo = br_new_control_info()) == NULL)
+        exit(errno);
+
+    for (house = 0; house < 16; house++) {
+        for (cmd = 0; cmd < PAUSE; cmd++) {
+            for (dev = 0; dev < (CMDHASDEVS(cmd) ? 16:1); dev++) {
+                if (br_add_cmd(cinfo, cmd, house, dev) < 0)
+                    exit(errno);
+            }
+        }
+    }
+
+    return cinfo;
+}
+
+static br_control_info *make_random_cinfo(int numcmds)
+{
+    br_control_info *cinfo;
+    br_unit_list *units;
+    register int i;
+    register int j;
+    int n;
+
+
+    if ((cinfo = br_new_control_info()) == NULL)
+        exit(errno);
+
+    for (i = 0; i < numcmds; i++) {
+        if ((units = br_new_unit_list()) == NULL)
+            exit(errno);
+
+        for (n = rand() % 4 + 1, j = 0; j < n; j++) {
+            if (br_add_unit(units, rand() % 16, rand() % 16) < 0)
+                exit(errno);
+        }
+
+        if (br_add_ul_cmd(cinfo, rand() % (PAUSE + 1), units) < 0)
+            exit(errno);
+
+        br_free_unit_list(units);
+    }
+
+    cinfo->inverse = rand() % 2;
+    cinfo->repeat = rand() % 3 + 1;
+    cinfo->stream = rand() % 2;
+
+    return cinfo;
+}
+
+static long bench_decode(int iterations)
+{
+    /*
+     * Round trips: send every encoding there is, then random command
+     *  lists, on the virtual backend, and check that decoding what came
+     *  out gives back exactly what went in.  Only the decoding and
+     *  checking are timed.  Any mismatch is fatal.
+     */
+
+    br_control_info *cinfo;
+    br_backend *backend;
+    br_virtual *v;
+    br_plan *plan;
+    br_decoded *frames;
+    int numframes;
+    int wrong;
+    register int i;
+    long items = 0;
+
+
+    if ((backend = br_new_virtual_backend()) == NULL)
+        exit(errno);
+
+    br_set_backend(backend);
+    v = br_virtual_state(backend);
+
+    srand(1999);
+
+    for (i = 0; i < iterations; i++) {
+        cinfo = i ? make_random_cinfo(100):make_every_cinfo();
+
+        if ((plan = br_compile(cinfo)) == NULL)
+            exit(errno);
+
+        br_virtual_reset(backend);
+
+        if (br_execute_plan(-1, plan) < 0)
+            exit(errno);
+
+        bench_start();
+
+        if ((numframes = br_decode(v->transitions, v->numtransitions, NULL,
+          &frames)) < 0)
+            exit(errno);
+
+        wrong = br_decode_compare(frames, numframes, plan);
+
+        bench_stop();
+
+        if (wrong) {
+            fprintf(stderr, "br_decode: %d of %d frames didn't round-trip "
+              "(iteration %d)\n", wrong, numframes, i);
+            exit(1);
+        }
+
+        items += numframes;
+
+        free(frames);
+        br_free_plan(plan);
+        br_free_control_info(cinfo);
+    }
+
+    br_free_virtual_backend(backend);
+
+    return items;
+}
+
+static struct {
+    char *name;
+    char *items;
+    long (*run)(int);
+    int iterations;
+} benchmarks[] = {
+    { "br_strtoul",             "units",    bench_strtoul,        200 },
+    { "br_add_unit",            "units",    bench_add_unit,       500 },
+    { "br_uldup",               "lists",    bench_uldup,          20000 },
+    { "br_add_ul_cmd",          "commands", bench_add_ul_cmd,     20 },
+    { "br_add_cmd_reuse",       "commands", bench_add_cmd_reuse,  20 },
+    { "br_del_unit",            "units",    bench_del_unit,       50 },
+    { "br_unit_sets",           "units",    bench_unit_sets,      100000 },
+    { "br_del_cmd",             "commands", bench_del_cmd,        10 },
+    { "br_compile",             "frames",   bench_compile,        20 },
+    { "br_execute",             "frames",   bench_execute_normal, 10 },
+    { "br_execute_stream",      "frames",   bench_execute_stream, 10 },
+    { "br_decode",              "frames",   bench_decode,         50 },
+    { NULL,                     NULL,       NULL,                 0 }
+};
+
+int main(int argc, char **argv)
+{
+    register int i;
+    int scale = 1;
+    long items;
+    int iterations;
+
+
+    /*
+     * An optional argument scales every benchmark's iteration count, for
+     *  quicker (or steadier) runs
+     */
+
+    if ((argc > 1) && ((scale = atoi(argv[1])) < 1)) {
+        fprintf(stderr, "usage: %s [scale]\n", argv[0]);
+        exit(EINVAL);
+    }
+
+    printf("{\n  \"scale\": %d,\n  \"benchmarks\": [\n", scale);
+
+    for (i = 0; benchmarks[i].name; i++) {
+        iterations = benchmarks[i].iterations * scale;
+
+        elapsed_nsecs = 0;
+        num_allocs = num_bytes = num_frees = 0;
+
+        items = benchmarks[i].run(iterations);
+
+        printf("    {\"name\": \"%s\", \"iterations\": %d, "
+          "\"items\": %ld, \"item\": \"%s\", \"nsecs\": %ld, "
+          "\"nsecs_per_item\": %.2f, \"items_per_sec\": %.0f, "
+          "\"allocs_per_iteration\": %.2f, \"bytes_per_iteration\": %.1f, "
+          "\"frees_per_iteration\": %.2f}%s\n",
+          benchmarks[i].name, iterations, items, benchmarks[i].items,
+          elapsed_nsecs, items ? (double)elapsed_nsecs / items:0.0,
+          elapsed_nsecs ? items * 1e9 / elapsed_nsecs:0.0,
+          (double)num_allocs / iterations, (double)num_bytes / iterations,
+          (double)num_frees / iterations,
+          benchmarks[i + 1].name ? ",":"");
+
+        fflush(stdout);
+    }
+
+    printf("  ]\n}\n");
+
+    return 0;
+}
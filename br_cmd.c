@@ -33,13 +33,21 @@ extern C {
 #include "config.h"
 #endif
 
+#ifdef __linux__
+#define _GNU_SOURCE     /* for sched_setaffinity() */
+#endif
+
 #include <unistd.h>
 #include <sys/ioctl.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <fcntl.h>
 #include <sys/types.h>
 #include <sys/time.h>
+#include <time.h>
 #include <string.h>
+#include <sched.h>
+#include <sys/mman.h>
 
 #ifdef HAVE_ERRNO_H
 #include <errno.h>
@@ -56,16 +64,9 @@ extern int errno;
 #endif
 
 #include "br_cmd.h"
-#include "br_translate.h"
-
-
-#ifndef TIOCM_FOR_0
-#define TIOCM_FOR_0 TIOCM_DTR
-#endif
-
-#ifndef TIOCM_FOR_1
-#define TIOCM_FOR_1 TIOCM_RTS
-#endif
+#include "br_plan.h"
+#include "br_backend.h"
+#include "br_state.h"
 
 /*
  * These values should be good for pretty much everyone, but you can
@@ -77,11 +78,18 @@ extern int errno;
  *   last.
  */
 
-int br_pre_cmd_delay = 350000;   /* empirically found... */
-int br_post_cmd_delay = 350000;
-int br_inter_bit_delay = 1400;
+#define PRE_CMD_DELAY    350000   /* empirically found... */
+#define POST_CMD_DELAY   350000
+#define INTER_BIT_DELAY  1400
 
-int br_verbose = 0;
+/*
+ * Gap between frames sent back-to-back (see br_stream_begin()); the
+ *  lines stay in "clock" position the whole time, so there's no need to
+ *  wait out both the post- and pre-command delays.  -1 means use
+ *  whichever of those is longer.
+ */
+
+#define INTER_FRAME_DELAY  -1
 
 const char *br_cmd_list[] = {
     "ON",
@@ -104,7 +112,81 @@ const char *br_cmd_list[] = {
 
 static void br_int_err_handler(char *, char *);
 
-void (*br_error_handler)(char *, char *) = br_int_err_handler;
+/*
+ * The context threads use unless they say otherwise; the old globals
+ *  (br_pre_cmd_delay and so on) are names for its fields.  A spin_usecs
+ *  of -1 means each thread measures its own the first time it's needed.
+ */
+
+br_context br_default_context = {
+    PRE_CMD_DELAY,
+    POST_CMD_DELAY,
+    INTER_BIT_DELAY,
+    INTER_FRAME_DELAY,
+    -1,
+    0,
+    br_int_err_handler,
+    0,
+    NULL
+};
+
+BR_THREAD br_context *br_current_context = NULL;
+
+br_context *br_new_context()
+{
+/*
+ * A new context, starting out the same as the default one
+ */
+
+    br_context *ctx;
+
+
+    if ((ctx = malloc(sizeof(br_context))) == NULL) {
+        br_error("br_new_context", "malloc");
+        return NULL;
+    }
+
+#ifdef MEM_DEBUG
+    printf("br_new_context: Malloced %d bytes at %lx\n", sizeof(br_context),
+      (unsigned long)ctx);
+#endif
+
+    *ctx = br_default_context;
+
+    return ctx;
+}
+
+int br_free_context(br_context *ctx)
+{
+    if ((ctx == NULL) || (ctx == &br_default_context))
+        return 0;
+
+    if (br_current_context == ctx)
+        br_current_context = NULL;
+
+#ifdef MEM_DEBUG
+    printf("br_free_context: Freeing memory at %lx\n", (unsigned long)ctx);
+#endif
+
+    free(ctx);
+
+    return 0;
+}
+
+br_context *br_use_context(br_context *ctx)
+{
+    /*
+     * Work in ctx from here on, in this thread.  Returns the context that
+     *  was in use before, to hand back here when done.
+     */
+
+    br_context *old = BR_CTX;
+
+
+    br_current_context = (ctx == &br_default_context) ? NULL:ctx;
+
+    return old;
+}
 
 void br_error(char *where, char *problem)
 {
@@ -113,12 +195,21 @@ void br_error(char *where, char *problem)
 
     tmperrno = errno;
 
-    if (br_error_handler)
-        (*br_error_handler)(where, problem);
+    if (BR_CTX->error_handler)
+        (*BR_CTX->error_handler)(where, problem);
 
     errno = tmperrno;
 }
 
+void br_error_ctx(br_context *ctx, char *where, char *problem)
+{
+    br_context *old = br_use_context(ctx);
+
+
+    br_error(where, problem);
+    br_use_context(old);
+}
+
 static void br_int_err_handler(char *where, char *problem)
 {
     int tmperrno = errno;
@@ -141,289 +232,881 @@ static void br_int_err_handler(char *where, char *problem)
     fprintf(stderr, "\n");
 }
 
-static int usec_sleep(long usecs)
+long br_cmd_usecs(int cmd)
 {
     /*
-     * Sleep for a little while.  Using select() so we don't busy-
-     *  wait for this long.
+     * Roughly how long it takes to get a command out, start to finish:
+     *  the hold before and after, plus a bit and a clock for each of the
+     *  40 bits in the frame and the clocks at either end.
      */
 
-    struct timeval sleeptime;
+    if (cmd == PAUSE)
+        return 1000000;
 
-    sleeptime.tv_sec = usecs / 1000000;
-    sleeptime.tv_usec = usecs % 1000000;
+    return (long)BR_CTX->pre_cmd_delay + BR_CTX->post_cmd_delay
+      + 82L * BR_CTX->inter_bit_delay;
+}
 
-    if (select(0, NULL, NULL, NULL, &sleeptime) < 0) {
-        br_error("usec_sleep", "select");
+/*
+ * Bit timing is done against absolute deadlines measured from the start
+ *  of each frame, so time spent in ioctl()s (or anywhere else) doesn't
+ *  add up over the 80 half-bits of a frame.  We sleep until shortly
+ *  before each deadline and spin for the rest; how early to wake up is
+ *  measured by each thread the first time it's needed, unless set in the
+ *  context's spin_usecs.  Timing all comes from the thread's context
+ *  (BR_CTX).
+ *
+ * The clock and the lines both belong to the current backend (see
+ *  br_backend.c); normally that's the serial port.
+ */
+
+#define time_add   br_time_add
+#define time_diff  br_time_diff
+
+static int time_now(struct timespec *now)
+{
+    if (BR_BACKEND->now(BR_BACKEND, now) < 0) {
+        br_error("time_now", "clock");
         return -1;
     }
 
     return 0;
 }
 
-static int usec_delay(long usecs)
+#define TIME_BEFORE(a, b) (((a)->tv_sec < (b)->tv_sec) \
+          || (((a)->tv_sec == (b)->tv_sec) && ((a)->tv_nsec < (b)->tv_nsec)))
+
+static int sleep_until(const struct timespec *deadline)
 {
     /*
-     * busy-wait for short delays
+     * Sleep (without spinning) until the deadline
      */
 
-    struct timeval endtime;
-    struct timeval currtime;
+    if (BR_BACKEND->sleep_until(BR_BACKEND, deadline) < 0) {
+        br_error("sleep_until", "sleep");
+        return -1;
+    }
+
+    return 0;
+}
 
+static int sleep_until_stat(const struct timespec *deadline, br_histogram *hist)
+{
     /*
-     * This way of doing things stolen from Firecracker, by Chris Yokum.
-     *   Much better.  What was I thinking before?
+     * Same as sleep_until(), noting how late we woke up
      */
 
-    if (gettimeofday(&endtime, NULL) < 0) {
-        br_error("usec_delay", "gettimeofday");
+    struct timespec now;
+
+
+    if (sleep_until(deadline) < 0)
         return -1;
+
+    if (hist && (time_now(&now) == 0))
+        br_hist_add(hist, time_diff(&now, deadline));
+
+    return 0;
+}
+
+static int usec_sleep(long usecs, br_histogram *hist)
+{
+    /*
+     * Sleep for a little while, without busy-waiting.  If hist isn't NULL,
+     *  how far off we were goes in it.
+     */
+
+    struct timespec deadline;
+
+
+    if (time_now(&deadline) < 0)
+        return -1;
+
+    time_add(&deadline, usecs);
+
+    return sleep_until_stat(&deadline, hist);
+}
+
+static BR_THREAD long measured_margin = -1;
+
+static long spin_margin()
+{
+    /*
+     * How far ahead of a deadline to stop sleeping and start spinning:
+     *  a bit more than the worst oversleep seen in a few short sleeps.
+     *  What's measured is kept to this thread; the context only has a
+     *  say if someone's set spin_usecs.
+     */
+
+    struct timespec target;
+    struct timespec now;
+    long late;
+    long worst = 0;
+    register int i;
+
+
+    if (BR_CTX->spin_usecs >= 0)
+        return BR_CTX->spin_usecs;
+
+    if (measured_margin >= 0)
+        return measured_margin;
+
+    for (i = 0; i < 8; i++) {
+        if (time_now(&target) < 0)
+            return 1000;
+
+        time_add(&target, 200);
+
+        if ((sleep_until(&target) < 0) || (time_now(&now) < 0))
+            return 1000;
+
+        if ((late = time_diff(&now, &target)) > worst)
+            worst = late;
     }
 
-    endtime.tv_usec += usecs;
+    worst += worst / 2 + 10;
+
+    measured_margin = (worst > 2000) ? 2000:worst;
+
+    return measured_margin;
+}
+
+static int wait_until(const struct timespec *deadline)
+{
+    /*
+     * Sleep most of the way to the deadline, then spin the rest
+     */
+
+    struct timespec now;
+    struct timespec wakeup;
+    long margin;
+
+
+    /*
+     * Backends that never oversleep don't need any help
+     */
+
+    if (BR_BACKEND->flags & BR_BACKEND_EXACT)
+        return sleep_until(deadline);
 
-    if (endtime.tv_usec >= 1000000) {
-        endtime.tv_sec++;
-        endtime.tv_usec -= 1000000;
+    margin = spin_margin();
+
+    if (time_now(&now) < 0)
+        return -1;
+
+    if (time_diff(deadline, &now) > margin) {
+        wakeup = *deadline;
+        time_add(&wakeup, -margin);
+
+        if (sleep_until(&wakeup) < 0)
+            return -1;
     }
 
     do {
-        if (gettimeofday(&currtime, NULL) < 0) {
-            br_error("usec_delay", "gettimeofday");
+        if (time_now(&now) < 0)
             return -1;
-        }
-    } while (timercmp(&endtime, &currtime, >));
+    } while (TIME_BEFORE(&now, deadline));
 
     return 0;
 }
 
-static int bits_out(const int fd, const int bits)
+/*
+ * Transmit statistics, kept separately by each thread that sends
+ */
+
+static BR_THREAD br_stats stats;
+static BR_THREAD struct timespec last_edge;
+static BR_THREAD int last_edge_valid = 0;
+static BR_THREAD int in_frame = 0;
+
+/*
+ * What the port's lines are doing, so they only need reading once per
+ *  port rather than once per frame; every change after that is written
+ *  whole, with one call (see lines_put()).
+ */
+
+#define BR_LINES (TIOCM_FOR_0 | TIOCM_FOR_1)
+#define CLOCK    BR_LINES                /* both up, between bits */
+
+static BR_THREAD struct {
+    br_backend *backend;
+    int fd;
+    int valid;
+    int lines;                           /* all of them, TIOCM_* */
+} port_lines;
+
+static int lines_put(const int fd, int lines, char *where)
 {
     /*
-     * Send out one command bit; set RTS or DTR (but only one) depending on
-     *  value.
-     *
-     * This now assumes that both RTS and DTR are high; it just clears the one
-     *  that we don't want set for this bit.
+     * Set DTR and RTS to exactly lines, leaving the rest as they are,
+     *  keeping track of how long that took and how long it's been since
+     *  the last change within the frame
      */
 
-    int out;
+    br_backend *backend = BR_BACKEND;
+    struct timespec before;
+    struct timespec after;
+    int have_time;
+    int up;
+    int down;
+    int rv;
 
 
-    out = (bits) ? TIOCM_FOR_0:TIOCM_FOR_1;
+    lines = (port_lines.lines & ~BR_LINES) | (lines & BR_LINES);
 
-    /* Set RTS, DTR to desired settings */
+    have_time = (time_now(&before) == 0);
 
-    if (ioctl(fd, TIOCMBIC, &out) < 0) {
-        br_error("bits_out", "ioctl");
-        return -1;
+    if (backend->put_lines) {
+        rv = backend->put_lines(backend, fd, lines);
+        stats.line_calls++;
+    } else {
+        /*
+         * Backends that can only raise or drop lines take one call for
+         *  each direction that's changing
+         */
+
+        up = lines & ~port_lines.lines & BR_LINES;
+        down = port_lines.lines & ~lines & BR_LINES;
+        rv = 0;
+
+        if (up) {
+            rv = backend->set_lines(backend, fd, up);
+            stats.line_calls++;
+        }
+
+        if (down && (rv == 0)) {
+            rv = backend->clear_lines(backend, fd, down);
+            stats.line_calls++;
+        }
     }
 
-    if (usec_delay(br_inter_bit_delay) < 0)
+    if (rv < 0) {
+        port_lines.valid = 0;
+        br_error(where, "ioctl");
         return -1;
+    }
+
+    port_lines.lines = lines;
+
+    if (have_time && (time_now(&after) == 0)) {
+        br_hist_add(&stats.ioctl, time_diff(&after, &before));
+
+        if (last_edge_valid) {
+            br_hist_add(&stats.half_bit,
+              time_diff(&before, &last_edge) - BR_CTX->inter_bit_delay);
+        }
+
+        last_edge = before;
+        last_edge_valid = in_frame;
+    }
 
     return 0;
 }
 
-static int clock_out(const int fd)
+void br_forget_lines(int fd)
+{
+    /*
+     * Read fd's lines again before its next frame (it's been closed, say,
+     *  or something else has been at them); -1 for any port
+     */
+
+    if ((fd < 0) || (fd == port_lines.fd))
+        port_lines.valid = 0;
+}
+
+static int clock_hold(const int fd, long usecs)
 {
     /*
-     * Send out a "clock pulse" -- both RTS and DTR set; used before/after
-     *  command (long pulse) and between command bits (short)
+     * Put the lines in "clock" position and leave them there a while
      */
 
-    int out = TIOCM_FOR_0 | TIOCM_FOR_1;
+    struct timespec deadline;
 
 
-    if (ioctl(fd, TIOCMBIS, &out) < 0) {
-        br_error("clock_out", "ioctl");
+    if ((time_now(&deadline) < 0) || (lines_put(fd, CLOCK, "clock_hold") < 0))
         return -1;
-    }
 
-    if (usec_delay(br_inter_bit_delay) < 0)
-        return -1;
-    
-    return 0;
+    time_add(&deadline, BR_CTX->inter_bit_delay + usecs);
+
+    return sleep_until_stat(&deadline, &stats.pre_delay);
 }
 
 
-int br_cmd(int fd, unsigned char unit, int cmd)
-{
+/*
+ * State kept while a stream of back-to-back frames is going out
+ */
+
+static BR_THREAD int stream_active = 0;
+static BR_THREAD int stream_gap_due = 0;
+static BR_THREAD long stream_gap = -1;
+static BR_THREAD int saved_lines;
+#ifdef USE_CLOCAL
+static BR_THREAD struct termios saved_termios;
+#endif
 
+long br_stream_gap(long usecs)
+{
     /*
-     * Put together the commands to send out.  The basic start and end of
-     *  each command is the same; just fill in the little bits in the middle
-     *
+     * Set the gap between back-to-back frames for whatever's being sent
+     *  now (a plan that was saved with one, say), in place of the
+     *  context's; returns the one it replaces
      */
 
-    unsigned char cmd_seq[5] = { 0xd5, 0xaa, 0x00, 0x00, 0xad };
+    long old = stream_gap;
+
+
+    stream_gap = (usecs >= 0) ? usecs:-1;
+
+    return old;
+}
+
+static long frame_gap()
+{
+    if (stream_gap >= 0)
+        return stream_gap;
+
+    if (BR_CTX->inter_frame_delay >= 0)
+        return BR_CTX->inter_frame_delay;
+
+    return (BR_CTX->pre_cmd_delay > BR_CTX->post_cmd_delay) ?
+      BR_CTX->pre_cmd_delay:BR_CTX->post_cmd_delay;
+}
+
+static int lines_grab(int fd, int *lines)
+{
+    /*
+     * Figure out what we'll need to do to put the lines back the way
+     *  we found them when we're done: *lines gets how DTR and RTS were.
+     */
 
-    register int i;
-    register int j;
-    unsigned char byte;
-    int out;
-    int housecode;
-    int serial_state;
-    int device;
 #ifdef USE_CLOCAL
-    struct termios termios;
     struct termios tmp_termios;
-#endif
 
 
-    if (cmd > MAX_CMD || cmd < 0)
-        return -1;
-
     /*
-     * Make sure to set the numeric part of the device address to 0
-     *  for dim/bright (they only work per housecode)
+     * Only a real serial port has a termios to fiddle with (which could
+     *  still be under a capture backend)
      */
-    
-    if ((cmd == DIM) || (cmd == BRIGHT))
-        unit &= 0xf0;
 
-    if (br_verbose >= 2) {
-        if (cmd == PAUSE) {
-            printf("Pausing 1 second\n");
-        } else if (ISDIMCMD(cmd)) {
-            printf("Sending command %s to %c\n",
-              br_cmd_list[cmd], 'A' + ((unit & 0xf0) >> 4));
-        } else {
-            printf("Sending command %s to %c%d\n",
-              br_cmd_list[cmd], 'A' + ((unit & 0xf0) >> 4),
-              (unit & 0x0f) + 1);
+    if (BR_BACKEND->flags & BR_BACKEND_PORT) {
+        if (tcgetattr(fd, &saved_termios) < 0) {
+            br_error("br_cmd", "tcgetattr");
+            return -1;
         }
-    }
 
-    if (cmd == PAUSE) {
-        return usec_sleep(1000000);
+        tmp_termios = saved_termios;
+
+        tmp_termios.c_cflag |= CLOCAL;
+
+        if (tcsetattr(fd, TCSANOW, &tmp_termios) < 0) {
+            br_error("br_cmd", "tcsetattr");
+            return -1;
+        }
     }
+#endif
 
-#ifdef USE_CLOCAL
-    if (tcgetattr(fd, &termios) < 0) {
-        br_error("br_cmd", "tcgetattr");
-        return -1;
+    /*
+     * Save current state of bits we don't want to touch in serial
+     *  register; nothing but us changes them once we've had a look, so
+     *  that's only needed the first time round for a port
+     */
+
+    if (!port_lines.valid || (port_lines.backend != BR_BACKEND)
+      || (port_lines.fd != fd))
+    {
+        stats.line_reads++;
+        stats.line_calls++;
+
+        if (BR_BACKEND->get_lines(BR_BACKEND, fd, &port_lines.lines) < 0) {
+            port_lines.valid = 0;
+            br_error("br_cmd", "ioctl");
+            return -1;
+        }
+
+        port_lines.backend = BR_BACKEND;
+        port_lines.fd = fd;
+        port_lines.valid = 1;
     }
 
-    tmp_termios = termios;
+    /*
+     * Just keep state of lines to be mucked with
+     */
 
-    tmp_termios.c_cflag |= CLOCAL;
+    *lines = port_lines.lines & BR_LINES;
 
-    if (tcsetattr(fd, TCSANOW, &tmp_termios) < 0) {
+    return 0;
+}
+
+static int lines_release(int fd, int lines)
+{
+    /*
+     * Restore the serial lines to how we found them
+     */
+
+    if (((port_lines.lines & BR_LINES) != lines)
+      && (lines_put(fd, lines, "x10_br_out") < 0))
+        return -1;
+
+#ifdef USE_CLOCAL
+    if ((BR_BACKEND->flags & BR_BACKEND_PORT)
+      && (tcsetattr(fd, TCSANOW, &saved_termios) < 0)) {
         br_error("br_cmd", "tcsetattr");
         return -1;
     }
 #endif
 
+    return 0;
+}
+
+/*
+ * Real-time mode.  What br_rt_enable() managed to get, and the priority
+ *  to run at while a frame is going out.
+ */
+
+static BR_THREAD int rt_granted = 0;
+static BR_THREAD int rt_priority = 0;
+
+int br_rt_enable(int cpu, int priority)
+{
     /*
-     * Save current state of bits we don't want to touch in serial
-     *  register
+     * Ask for whatever real-time help is available: memory locked down
+     *  so we don't page fault in the middle of a frame, optionally a CPU
+     *  of our own, and permission to run SCHED_FIFO.  We only actually
+     *  run SCHED_FIFO while bits are going out (see frame_out()); the
+     *  long pre/post delays are spent at normal priority.
+     *
+     * Returns which of BR_RT_MLOCK, BR_RT_AFFINITY and BR_RT_SCHED were
+     *  granted; usually nothing, unless we're root (or have the right
+     *  capabilities).
      */
-    
-    if (ioctl(fd, TIOCMGET, &serial_state) < 0) {
-        br_error("br_cmd", "ioctl");
-        return -1;
+
+    int granted = 0;
+#ifdef _POSIX_PRIORITY_SCHEDULING
+    struct sched_param param;
+#endif
+#ifdef CPU_SET
+    cpu_set_t cpus;
+#endif
+
+
+#ifdef _POSIX_MEMLOCK
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) == 0)
+        granted |= BR_RT_MLOCK;
+#endif
+
+#ifdef CPU_SET
+    if (cpu >= 0) {
+        CPU_ZERO(&cpus);
+        CPU_SET(cpu, &cpus);
+
+        if (sched_setaffinity(0, sizeof(cpus), &cpus) == 0)
+            granted |= BR_RT_AFFINITY;
     }
-    
+#endif
+
+#ifdef _POSIX_PRIORITY_SCHEDULING
+    if (priority <= 0) {
+        priority = (sched_get_priority_min(SCHED_FIFO)
+          + sched_get_priority_max(SCHED_FIFO)) / 2;
+    }
+
+    if (priority > sched_get_priority_max(SCHED_FIFO))
+        priority = sched_get_priority_max(SCHED_FIFO);
+
     /*
-     * Just keep state of lines to be mucked with
+     * Try it once to see if we're allowed, then go back to normal
      */
 
-    serial_state &= (TIOCM_FOR_0 | TIOCM_FOR_1);
-    
-     /* Figure out which ones we're going to want to clear
-     *  when finished (they'll both be high after the last
-     *  clock_out)
-     */
+    param.sched_priority = priority;
 
-    serial_state ^= (TIOCM_FOR_0 | TIOCM_FOR_1);
+    if (sched_setscheduler(0, SCHED_FIFO, &param) == 0) {
+        granted |= BR_RT_SCHED;
+        param.sched_priority = 0;
+        sched_setscheduler(0, SCHED_OTHER, &param);
+    }
+#endif
 
-    housecode = unit >> 4;
-    device = unit & 0x0f;
+    rt_granted = granted;
+    rt_priority = priority;
 
-    /*
-     * Slap together the variable part of a command
-     */
+    return granted;
+}
+
+void br_rt_disable()
+{
+#ifdef _POSIX_MEMLOCK
+    if (rt_granted & BR_RT_MLOCK)
+        munlockall();
+#endif
+
+    rt_granted = 0;
+}
+
+static void rt_enter()
+{
+#ifdef _POSIX_PRIORITY_SCHEDULING
+    struct sched_param param;
+
+
+    if (rt_granted & BR_RT_SCHED) {
+        param.sched_priority = rt_priority;
+        sched_setscheduler(0, SCHED_FIFO, &param);
+    }
+#endif
+}
+
+static void rt_leave()
+{
+#ifdef _POSIX_PRIORITY_SCHEDULING
+    struct sched_param param;
 
-    cmd_seq[2] |= housecode_table[housecode] << 4 | device_table[device][0];
-    cmd_seq[3] |= device_table[device][1] | cmd_table[cmd];
 
+    if (rt_granted & BR_RT_SCHED) {
+        param.sched_priority = 0;
+        sched_setscheduler(0, SCHED_OTHER, &param);
+    }
+#endif
+}
+
+static int frame_bits_out(int fd, const unsigned char *cmd_seq)
+{
     /*
-     * Set lines to clock and wait, to make sure receiver is ready
+     * Roll a frame out onto the lines.  Expects the lines to already be in
+     *  "clock" position, and leaves them there.
+     *
+     * Every state the lines go through is worked out before the first one
+     *  goes out, so all that's left in the timed part is writing each one
+     *  and waiting for its turn to end.
      */
 
-    if (clock_out(fd) < 0)
-        return -1;
+    register int i;
+    register int j;
+    register int n;
+    unsigned char byte;
+    int out;
+    int states[BR_FRAME_LEN * 16];
+    struct timespec deadline;
 
-    if (usec_sleep(br_pre_cmd_delay) < 0)
-        return -1;
 
-    if (br_verbose == 5) {
+    if (BR_CTX->verbose == 5) {
         printf("              -------HEAD------ -----COMMAND----- --FOOT--\n");
         printf("sending bits: ");
-    } else if (br_verbose == 4) {
+    } else if (BR_CTX->verbose == 4) {
         printf("Sending bytes: ");
     }
 
-    for (j = 0; j < 5; j++) {
+    for (j = 0, n = 0; j < BR_FRAME_LEN; j++) {
         byte = cmd_seq[j];
 
-        if (br_verbose == 4)
+        if (BR_CTX->verbose == 4)
             printf("%02x", (unsigned int)byte);
 
         /*
-         * Roll out the bits, following each one by a "clock".
+         * Each bit drops RTS or DTR (but only one) depending on its value,
+         *  and is followed by a "clock" with both up again
          */
 
         for (i = 0; i < 8; i++) {
             out = (byte & 0x80) ? 1:0;
             byte <<= 1;
 
-            if (br_verbose == 5)
+            if (BR_CTX->verbose == 5)
                 printf("%d", out);
 
-            if ((bits_out(fd, out) < 0) || (clock_out(fd) < 0))
-                return -1;
+            states[n++] = CLOCK & ~(out ? TIOCM_FOR_0:TIOCM_FOR_1);
+            states[n++] = CLOCK;
         }
 
-        if ((br_verbose == 4) || (br_verbose == 5))
+        if ((BR_CTX->verbose == 4) || (BR_CTX->verbose == 5))
             printf(" ");
     }
 
-    if ((br_verbose == 4) || (br_verbose == 5)) {
+    if ((BR_CTX->verbose == 4) || (BR_CTX->verbose == 5)) {
         printf("\n");
         fflush(stdout);
     }
 
     /*
-     * Close with a clock pulse and wait a bit to allow command to complete
+     * The last bit's "clock" already leaves the lines where they started,
+     *  so nothing more goes out after it
      */
 
-    if (clock_out(fd) < 0)
+    /*
+     * Every transition in the frame is timed from here
+     */
+
+    if (time_now(&deadline) < 0)
+        return -1;
+
+    for (i = 0; i < n; i++) {
+        if (lines_put(fd, states[i], "frame_bits_out") < 0)
+            return -1;
+
+        time_add(&deadline, BR_CTX->inter_bit_delay);
+
+        if (wait_until(&deadline) < 0)
+            return -1;
+    }
+
+    return 0;
+}
+
+static int frame_out(int fd, const unsigned char *cmd_seq)
+{
+    int rv;
+    int tmperrno;
+
+
+    rt_enter();
+
+    in_frame = 1;
+    last_edge_valid = 0;
+
+    rv = frame_bits_out(fd, cmd_seq);
+
+    in_frame = 0;
+    last_edge_valid = 0;
+
+    tmperrno = errno;
+    rt_leave();
+    errno = tmperrno;
+
+    if (rv == 0)
+        stats.frames++;
+
+    return rv;
+}
+
+int br_stream_begin(int fd)
+{
+    /*
+     * Start a run of back-to-back commands: the lines go to "clock" and
+     *  stay there until br_stream_end(), and commands sent with br_cmd()
+     *  in between are separated by a single inter-frame gap instead of
+     *  a full post-command plus pre-command delay.
+     */
+
+    if (stream_active) {
+        errno = EBUSY;
+        br_error("br_stream_begin", "Stream already active");
         return -1;
+    }
 
-    if (usec_sleep(br_post_cmd_delay) < 0)
+    if (lines_grab(fd, &saved_lines) < 0)
         return -1;
 
     /*
-     * Restore the serial lines to how we found them
+     * Set lines to clock and wait, to make sure receiver is ready
      */
 
-    if (ioctl(fd, TIOCMBIC, &serial_state) < 0) {
-       br_error("x10_br_out", "ioctl");
-       return -1;
+    if (clock_hold(fd, BR_CTX->pre_cmd_delay) < 0) {
+        lines_release(fd, saved_lines);
+        return -1;
     }
 
-#ifdef USE_CLOCAL
-    if (tcsetattr(fd, TCSANOW, &termios) < 0) {
-        br_error("br_cmd", "tcsetattr");
+    stream_active = 1;
+    stream_gap_due = 0;
+
+    return 0;
+}
+
+int br_stream_end(int fd)
+{
+    int rv = 0;
+
+
+    if (!stream_active)
+        return 0;
+
+    stream_active = 0;
+
+    /*
+     * Wait a bit to allow the last command to complete
+     */
+
+    if (stream_gap_due && (usec_sleep(BR_CTX->post_cmd_delay, &stats.post_delay) < 0))
+        rv = -1;
+
+    if (lines_release(fd, saved_lines) < 0)
+        rv = -1;
+
+    return rv;
+}
+
+int br_get_stats(br_stats *copy)
+{
+    if (copy == NULL) {
+        errno = EINVAL;
+        br_error("br_get_stats", "NULL stats pointer");
         return -1;
     }
-#endif
+
+    *copy = stats;
+
+    return 0;
+}
+
+int br_reset_stats()
+{
+    memset(&stats, 0, sizeof(stats));
+
+    return 0;
+}
+
+int br_send_frame(int fd, const br_frame *frame)
+{
+    /*
+     * Send out an already-encoded frame (see br_make_frame())
+     */
+
+    int lines;
+
+
+    if (BR_CTX->verbose >= 2) {
+        if (frame->cmd == PAUSE) {
+            printf("Pausing 1 second\n");
+        } else if (ISDIMCMD(frame->cmd)) {
+            printf("Sending command %s to %c\n",
+              br_cmd_list[frame->cmd], 'A' + ((frame->unit & 0xf0) >> 4));
+        } else {
+            printf("Sending command %s to %c%d\n",
+              br_cmd_list[frame->cmd], 'A' + ((frame->unit & 0xf0) >> 4),
+              (frame->unit & 0x0f) + 1);
+        }
+    }
+
+    if (frame->cmd == PAUSE) {
+        /*
+         * A second is plenty of gap before whatever comes next
+         */
+
+        stream_gap_due = 0;
+        return usec_sleep(1000000, NULL);
+    }
+
+    if (stream_active) {
+        if (stream_gap_due && (usec_sleep(frame_gap(), &stats.gap) < 0))
+            return -1;
+
+        stream_gap_due = 1;
+
+        if (frame_out(fd, frame->bytes) < 0)
+            return -1;
+
+        br_state_sent(frame->unit, frame->cmd);
+
+        return 0;
+    }
+
+    if (lines_grab(fd, &lines) < 0)
+        return -1;
+
+    /*
+     * Set lines to clock and wait, to make sure receiver is ready
+     */
+
+    if (clock_hold(fd, BR_CTX->pre_cmd_delay) < 0)
+        return -1;
+
+    if (frame_out(fd, frame->bytes) < 0)
+        return -1;
+
+    /*
+     * Wait a bit to allow command to complete
+     */
+
+    if (usec_sleep(BR_CTX->post_cmd_delay, &stats.post_delay) < 0)
+        return -1;
+
+    if (lines_release(fd, lines) < 0)
+        return -1;
+
+    br_state_sent(frame->unit, frame->cmd);
 
     return 0;
 }
 
+int br_cmd(int fd, unsigned char unit, int cmd)
+{
+    br_frame frame;
+
+
+    if (cmd > PAUSE || cmd < 0)
+        return -1;
+
+    if (br_make_frame(&frame, unit, cmd) < 0)
+        return -1;
+
+    return br_send_frame(fd, &frame);
+}
+
+/*
+ * The same, in a given context rather than the thread's own
+ */
+
+long br_cmd_usecs_ctx(br_context *ctx, int cmd)
+{
+    br_context *old = br_use_context(ctx);
+    long rv;
+    int tmperrno;
+
+
+    rv = br_cmd_usecs(cmd);
+
+    tmperrno = errno;
+    br_use_context(old);
+    errno = tmperrno;
+
+    return rv;
+}
+
+int br_stream_begin_ctx(br_context *ctx, int fd)
+{
+    br_context *old = br_use_context(ctx);
+    int rv;
+    int tmperrno;
+
+
+    rv = br_stream_begin(fd);
+
+    tmperrno = errno;
+    br_use_context(old);
+    errno = tmperrno;
+
+    return rv;
+}
+
+int br_stream_end_ctx(br_context *ctx, int fd)
+{
+    br_context *old = br_use_context(ctx);
+    int rv;
+    int tmperrno;
+
+
+    rv = br_stream_end(fd);
+
+    tmperrno = errno;
+    br_use_context(old);
+    errno = tmperrno;
+
+    return rv;
+}
+
+int br_cmd_ctx(br_context *ctx, int fd, unsigned char unit, int cmd)
+{
+    br_context *old = br_use_context(ctx);
+    int rv;
+    int tmperrno;
+
+
+    rv = br_cmd(fd, unit, cmd);
+
+    tmperrno = errno;
+    br_use_context(old);
+    errno = tmperrno;
+
+    return rv;
+}
+
 #ifdef __cplusplus
 }
 #endif
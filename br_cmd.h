@@ -27,6 +27,8 @@
  *
  */
 
+#include <stdio.h>
+
 #define DIMRANGE 12
 #define ISDIMCMD(cmd) ((cmd == DIM) || (cmd == BRIGHT))
 #define CMDHASDEVS(cmd) ((cmd == ON) || (cmd == OFF))  /* command need device to work on? */
@@ -55,28 +57,136 @@
 
 extern const char *br_cmd_list[];
 
+/*
+ * Sending state (stream, statistics, real-time mode, backend) belongs to
+ *  the thread doing the sending, so engines with several ports can keep
+ *  several going at once (see br_async.c).  Without thread-local storage
+ *  that can't work, so there's no building without it.
+ */
+
+#if defined(__cplusplus) && (__cplusplus >= 201103L)
+#define BR_THREAD thread_local
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+#define BR_THREAD _Thread_local
+#elif defined(__GNUC__)
+#define BR_THREAD __thread
+#else
+#error "BottleRocket needs thread-local storage (C11 _Thread_local)"
+#endif
+
 int br_cmd(int /* file desc */, unsigned char /* address */, int /* cmd */);
-void br_error(char * /* where */, char * /* problem */);
+long br_cmd_usecs(int /* cmd */);
+int br_stream_begin(int /* file desc */);
+int br_stream_end(int /* file desc */);
+long br_stream_gap(long /* uSec, or -1 for the context's */);
+void br_forget_lines(int /* file desc, or -1 for any */);
 
 /*
- * Shouldn't need to mess with timing things, but just in case you want to...
+ * Real-time help for getting bits out on time on a loaded machine; see
+ *  br_rt_enable() for what's what.
  */
 
-extern int br_pre_cmd_delay;
-extern int br_post_cmd_delay;
-extern int br_inter_bit_delay;
+#define BR_RT_SCHED     0x01   /* SCHED_FIFO while sending frames */
+#define BR_RT_MLOCK     0x02   /* memory locked */
+#define BR_RT_AFFINITY  0x04   /* pinned to a CPU */
 
 /*
- * How verbose should we be?
+ * Transmit statistics: how far off the timing actually was.  Values are
+ *  in uSec; each histogram bucket n > 0 counts values whose magnitude is
+ *  in [2^(n-1), 2^n), bucket 0 counts those under 1 uSec.
  */
 
-extern int br_verbose;
+#define BR_HIST_BUCKETS 24
+
+typedef struct {
+    unsigned long count;
+    long min;
+    long max;
+    double sum;
+    unsigned long buckets[BR_HIST_BUCKETS];
+} br_histogram;
+
+typedef struct {
+    unsigned long frames;
+    br_histogram half_bit;     /* actual - intended length of each half-bit */
+    br_histogram pre_delay;    /* lateness of the pre-command hold */
+    br_histogram post_delay;   /* lateness of the post-command delay */
+    br_histogram gap;          /* lateness of back-to-back inter-frame gaps */
+    br_histogram ioctl;        /* time taken by each line-changing ioctl */
+    unsigned long line_calls;  /* ioctl()s (and termios calls) on the port */
+    unsigned long line_reads;  /* of those, reading the lines back */
+} br_stats;
+
+int br_get_stats(br_stats *);
+int br_reset_stats();
+void br_hist_add(br_histogram *, long /* value */);
+void br_print_stats(FILE *, br_stats *);
+
+int br_rt_enable(int /* cpu, or -1 */, int /* priority, or 0 for default */);
+void br_rt_disable();
+void br_error(char * /* where */, char * /* problem */);
 
 /*
- * In case an application wants to handle the errors for itself, it can
- *  change this to point to its own error handler.
+ * Everything about how the library goes about things that used to be
+ *  process-wide: timing, verbosity, where errors go, the default
+ *  housecode and the backend.  Each thread works in a context of its own
+ *  choosing (br_use_context(), or the *_ctx() version of a call), so
+ *  several can send to different ports, with different timing, at once.
+ *  Threads that never pick one use br_default_context, which is what the
+ *  old globals (br_pre_cmd_delay and the rest, below) are now part of.
  */
 
-extern void (*br_error_handler)(char * /* where */, char * /*problem */);
+struct br_backend;
+
+typedef struct {
+
+    /*
+     * Shouldn't need to mess with timing things, but just in case you
+     *  want to...  (all in uSec)
+     */
+
+    int pre_cmd_delay;
+    int post_cmd_delay;
+    int inter_bit_delay;
+    int inter_frame_delay;
+    int spin_usecs;
+
+    int verbose;                /* how verbose should we be? */
+
+    /*
+     * In case an application wants to handle the errors for itself, it
+     *  can point this at its own error handler (or NULL for silence).
+     */
+
+    void (*error_handler)(char * /* where */, char * /* problem */);
+
+    int default_house;          /* for unit lists without one */
+    struct br_backend *backend; /* NULL for the serial port (unless the
+                                 *  thread's set one; see br_set_backend()) */
+} br_context;
+
+extern br_context br_default_context;
+extern BR_THREAD br_context *br_current_context;
+
+#define BR_CTX  (br_current_context ? br_current_context:&br_default_context)
+
+#define br_pre_cmd_delay       (br_default_context.pre_cmd_delay)
+#define br_post_cmd_delay      (br_default_context.post_cmd_delay)
+#define br_inter_bit_delay     (br_default_context.inter_bit_delay)
+#define br_inter_frame_delay   (br_default_context.inter_frame_delay)
+#define br_spin_usecs          (br_default_context.spin_usecs)
+#define br_verbose             (br_default_context.verbose)
+#define br_error_handler       (br_default_context.error_handler)
+#define br_default_house       (br_default_context.default_house)
+
+br_context *br_new_context();
+int br_free_context(br_context *);
+br_context *br_use_context(br_context * /* NULL for the default */);
+int br_cmd_ctx(br_context *, int /* file desc */, unsigned char /* address */,
+              int /* cmd */);
+long br_cmd_usecs_ctx(br_context *, int /* cmd */);
+int br_stream_begin_ctx(br_context *, int /* file desc */);
+int br_stream_end_ctx(br_context *, int /* file desc */);
+void br_error_ctx(br_context *, char * /* where */, char * /* problem */);
 
 #endif
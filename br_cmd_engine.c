@@ -40,11 +40,10 @@ extern C {
 
 #include "br_cmd.h"
 #include "br_cmd_engine.h"
+#include "br_plan.h"
 
 
 
-int br_default_house = 0;
-
 int br_inverse_cmd(int cmd)
 {
     switch (cmd) {
@@ -83,12 +82,10 @@ int br_execute(int fd, br_control_info *cinfo)
  * Run through a list of commands and execute them
  */
 
-    register int i;
-    register int j;
-    register int repeat = cinfo->repeat;
-    int inverse = cinfo->inverse;
-    char unit;
+    br_plan *plan;
     int rv;
+    int tmperrno;
+
 
     if (cinfo == NULL) {
         errno = EINVAL;
@@ -102,38 +99,20 @@ int br_execute(int fd, br_control_info *cinfo)
         return -1;
     }
 
-    /* However many times we have to repeat this thing... */
-
-    for (; repeat > 0; repeat--) {
-
-        /* Do for each command in the command list... */
-
-        for (i = 0; i < cinfo->numcmds; i++) {
-
-            /* For each device in the device list for that command */
-
-            if (CMDHASDEVS(cinfo->cmds[i]) && cinfo->units[i]->devs == NULL) {
-                errno = EINVAL;
-                br_error("br_execute", "NULL device list");
-                return -1;
-            }
-
-            for (j = 0; j < (CMDHASDEVS(cinfo->cmds[i]) ? cinfo->units[i]->numunits:1); j++) {
+    /*
+     * Work out every frame up front, then just send them
+     */
 
-                unit = ((char)cinfo->units[i]->houses[j] << 4)
-                  | (CMDHASDEVS(cinfo->cmds[i]) ? cinfo->units[i]->devs[j]:0);
+    if ((plan = br_compile(cinfo)) == NULL)
+        return -1;
 
-                rv = br_cmd(fd, unit,
-                  (inverse < 0) ? br_inverse_cmd(cinfo->cmds[i]):cinfo->cmds[i]);
-                if (rv < 0)
-                    return -1;
-            }
-        }
+    rv = br_execute_plan(fd, plan);
 
-        if (inverse) inverse = 0 - inverse;
-    }
+    tmperrno = errno;
+    br_free_plan(plan);
+    errno = tmperrno;
 
-    return 0;
+    return rv;
 }
 
 br_unit_list *br_new_unit_list()
@@ -152,38 +131,53 @@ br_unit_list *br_new_unit_list()
       sizeof(br_unit_list), (unsigned long)units);
 #endif
 
-    units->allocatedunits = 0;
     units->numunits = 0;
-    units->devs = NULL;
-    units->houses = NULL;
+    units->wild = 0;
+    br_us_clear(&units->set);
+    memset(units->last, 0, sizeof(units->last));
+    units->arena = NULL;
 
     return units;
 }
 
-int br_free_unit_list(br_unit_list *units)
+br_unit_list *br_new_cmd_unit_list(br_control_info *cinfo)
 {
-    if (units == NULL)
-        return 0;
+/*
+ * A unit list that lives in the control info's arena, meant to be handed
+ *  over with br_add_ul_cmd_take().  It goes away with the control info
+ *  (or br_free_cmds()); br_free_unit_list() on it does nothing.
+ */
 
-    if (units->devs != NULL) {
+    br_unit_list *units;
 
-#ifdef MEM_DEBUG
-        printf("br_free_unit_list: Freeing memory at %lx\n",
-          (unsigned long)units->devs);
-#endif
 
-        free(units->devs);
+    if (cinfo == NULL) {
+        errno = EINVAL;
+        br_error("br_new_cmd_unit_list", "NULL control info pointer");
+        return NULL;
     }
 
-    if (units->houses != NULL) {
+    if (cinfo->arena == NULL)
+        return br_new_unit_list();
 
-#ifdef MEM_DEBUG
-        printf("br_free_unit_list: Freeing memory at %lx\n",
-            (unsigned long)units->houses);
-#endif
+    units = br_arena_alloc(cinfo->arena, sizeof(br_unit_list));
 
-        free(units->houses);
-    }
+    if (units == NULL)
+        return NULL;
+
+    units->numunits = 0;
+    units->wild = 0;
+    br_us_clear(&units->set);
+    memset(units->last, 0, sizeof(units->last));
+    units->arena = cinfo->arena;
+
+    return units;
+}
+
+int br_free_unit_list(br_unit_list *units)
+{
+    if ((units == NULL) || units->arena)
+        return 0;       /* arena lists go when the arena does */
 
 #ifdef MEM_DEBUG
     printf("br_free_unit_list: Freeing memory at %lx\n",
@@ -203,56 +197,32 @@ int br_add_unit(br_unit_list *units, int house, int dev)
         return -1;
     }
 
-    if (units->numunits >= units->allocatedunits) {
-
-#ifdef MEM_DEBUG
-     printf("br_add_unit: Reallocing memory from %lx...\n",
-      (unsigned long)units->devs);
-#endif
-
-        units->devs = realloc(units->devs, (units->allocatedunits + UNIT_BLKSIZE) * sizeof(int));
-
-        if (units->devs == NULL) {
-            br_error("br_add_unit", "realloc");
-            return -1;
-        }
-
-#ifdef MEM_DEBUG
-    printf("br_add_unit: Realloced %d bytes at %lx\n",
-      (units->allocatedunits + UNIT_BLKSIZE) * sizeof(int), (unsigned long)units->devs);
-
-     printf("br_add_unit: Reallocing memory from %lx...\n",
-      (unsigned long)units->houses);
-#endif
-
-        units->houses = realloc(units->houses, (units->allocatedunits + UNIT_BLKSIZE) * sizeof(int));
-
-        if (units->houses == NULL) {
-            br_error("br_add_unit", "realloc");
-            return -1;
-        }
-
-#ifdef MEM_DEBUG
-    printf("br_add_unit: Realloced %d bytes at %lx\n",
-      (units->allocatedunits + UNIT_BLKSIZE) * sizeof(int), (unsigned long)units->houses);
-#endif
-
-        units->allocatedunits += UNIT_BLKSIZE;
-
+    if ((house < 0) || (house > 15) || (dev < 0) || (dev > 15)) {
+        errno = EINVAL;
+        br_error("br_add_unit", "Bad unit");
+        return -1;
     }
 
-    units->devs[units->numunits] = dev;
-    units->houses[units->numunits] = house;
+    /*
+     * Units already in the list stay where they are, but whichever was
+     *  added last goes out last in its housecode
+     */
 
-    units->numunits++;
+    units->numunits += br_us_add(&units->set, BR_UNIT(house, dev));
+    units->last[house] = dev + 1;
 
     return 0;
 }
 
 int br_del_unit(br_unit_list *units, int house, int dev)
 {
-    register int i;
-    int moveby = 0;
+/*
+ * As always, a house or device of 0 matches any; so (0, 0) empties
+ *  the list
+ */
+
+    register int h;
+    register int d;
 
 
     if (units == NULL) {
@@ -261,52 +231,23 @@ int br_del_unit(br_unit_list *units, int house, int dev)
         return -1;
     }
 
-    for (i = 0; i < (units->numunits - moveby); i++) {
-        if (
-          ((units->devs && (units->devs[i] == dev))
-            || (dev == 0))
-          && ((units->houses && (units->houses[i] == house))
-            || (house == 0))
-        )
-        {
-            moveby++;
-        }
-
-        if (units->devs)
-            units->devs[i] = units->devs[i + moveby];
-
-        if (units->houses)
-            units->houses[i] = units->houses[i + moveby];
+    if ((house < 0) || (house > 15) || (dev < 0) || (dev > 15)) {
+        errno = EINVAL;
+        br_error("br_del_unit", "Bad unit");
+        return -1;
     }
 
-    units->numunits -= moveby;
-
-    if (units->numunits == 0) {
-
-        if (units->devs) {
-
-#ifdef MEM_DEBUG
-        printf("br_del_unit: Freeing memory at %lx\n",
-          (unsigned long)units->devs);
-#endif
-
-            free(units->devs);
-            units->devs = NULL;
-        }
-
-        if (units->houses) {
-
-#ifdef MEM_DEBUG
-        printf("br_del_unit: Freeing memory at %lx\n",
-          (unsigned long)units->houses);
-#endif
-
-            free(units->houses);
-            units->houses = NULL;
-        }
-
+    if (!house && !dev) {
+        br_us_clear(&units->set);
+        memset(units->last, 0, sizeof(units->last));
         units->numunits = 0;
-        units->allocatedunits = 0;
+        units->wild = 0;
+        return 0;
+    }
+
+    for (h = house ? house:0; h <= (house ? house:15); h++) {
+        for (d = dev ? dev:0; d <= (dev ? dev:15); d++)
+            units->numunits -= br_us_del(&units->set, BR_UNIT(h, d));
     }
 
     return 0;
@@ -332,10 +273,24 @@ br_control_info *br_new_control_info()
 
     cinfo->inverse = 0;
     cinfo->repeat = 1;
+    memset(&cinfo->retx, 0, sizeof(cinfo->retx));
+    cinfo->stream = 0;
+    cinfo->priority = BR_PRI_INTERACTIVE;
+    cinfo->gap = -1;
     cinfo->numcmds = 0;
     cinfo->allocatedcmds = 0;
     cinfo->units = NULL;
     cinfo->cmds = NULL;
+    cinfo->heaplists = 0;
+
+    /*
+     * Everything the commands need comes out of here
+     */
+
+    if ((cinfo->arena = br_new_arena(ARENA_BLKSIZE)) == NULL) {
+        free(cinfo);
+        return NULL;
+    }
 
     return cinfo;
 }
@@ -344,6 +299,7 @@ int br_free_control_info(br_control_info *cinfo)
 {
     if (cinfo) {
         br_free_cmds(cinfo);
+        br_free_arena(cinfo->arena);
 
 #ifdef MEM_DEBUG
         printf("br_free_control_info: Freeing memory at %lx\n",
@@ -364,6 +320,19 @@ int br_malloc_cmds(br_control_info *cinfo, int numcmds)
         return -1;
     }
 
+    if (cinfo->arena) {
+        cinfo->cmds = br_arena_alloc(cinfo->arena, numcmds * sizeof(int));
+        cinfo->units = br_arena_alloc(cinfo->arena,
+          numcmds * sizeof(br_unit_list *));
+
+        if ((cinfo->cmds == NULL) || (cinfo->units == NULL))
+            return -1;
+
+        cinfo->allocatedcmds = numcmds;
+
+        return 0;
+    }
+
     cinfo->cmds = malloc(numcmds * sizeof(int));
 
     if ((cinfo->cmds) == NULL) {
@@ -395,12 +364,33 @@ int br_malloc_cmds(br_control_info *cinfo, int numcmds)
 
 int br_realloc_cmds(br_control_info *cinfo, int numcmds)
 {
+    int *cmds;
+    br_unit_list **units;
+
+
     if (cinfo == NULL) {
         errno = EINVAL;
         br_error("br_realloc_cmds", "NULL control info pointer");
         return -1;
     }
 
+    if (cinfo->arena) {
+        cmds = br_arena_realloc(cinfo->arena, cinfo->cmds,
+          cinfo->allocatedcmds * sizeof(int), numcmds * sizeof(int));
+        units = br_arena_realloc(cinfo->arena, cinfo->units,
+          cinfo->allocatedcmds * sizeof(br_unit_list *),
+          numcmds * sizeof(br_unit_list *));
+
+        if ((cmds == NULL) || (units == NULL))
+            return -1;
+
+        cinfo->cmds = cmds;
+        cinfo->units = units;
+        cinfo->allocatedcmds = numcmds;
+
+        return 0;
+    }
+
 #ifdef MEM_DEBUG
     printf("br_realloc_cmds: Reallocing memory from %lx...\n",
       (unsigned long)cinfo->cmds);
@@ -448,6 +438,31 @@ int br_free_cmds(br_control_info *cinfo)
         return 0;
     }
 
+    if (cinfo->arena) {
+
+        /*
+         * Only unit lists handed over from outside the arena need to be
+         *  freed one by one; everything else goes back in one reset
+         */
+
+        for (i = 0; cinfo->heaplists && (i < cinfo->numcmds); i++) {
+            if (cinfo->units[i] && (cinfo->units[i]->arena == NULL)) {
+                br_free_unit_list(cinfo->units[i]);
+                cinfo->heaplists--;
+            }
+        }
+
+        br_arena_reset(cinfo->arena);
+
+        cinfo->cmds = NULL;
+        cinfo->units = NULL;
+        cinfo->numcmds = 0;
+        cinfo->allocatedcmds = 0;
+        cinfo->heaplists = 0;
+
+        return 0;
+    }
+
     if (cinfo->cmds) {
 
 #ifdef MEM_DEBUG
@@ -480,14 +495,32 @@ int br_free_cmds(br_control_info *cinfo)
     return 0;
 }
 
+static br_unit_list *copy_units(br_control_info *cinfo, br_unit_list *a)
+{
+    br_unit_list *units;
+
+
+    if (cinfo->arena == NULL)
+        return br_uldup(a);
+
+    if ((units = br_new_cmd_unit_list(cinfo)) == NULL)
+        return NULL;
+
+    br_ul_copy(units, a);
+
+    return units;
+}
+
 int br_add_ul_cmd(br_control_info *cinfo, int cmd, br_unit_list *units)
 {
     /*
      * Add a command, plus devices for it to act on and other info, to the
-     *  list of commands to be executed
+     *  list of commands to be executed.  The caller keeps units; what
+     *  goes in the list is a copy.
      */
 
     br_unit_list *tmpunits;
+    int tmperrno;
 
 
     if (cinfo == NULL) {
@@ -502,55 +535,149 @@ int br_add_ul_cmd(br_control_info *cinfo, int cmd, br_unit_list *units)
         return -1;
     }
 
-    tmpunits = br_uldup(units);
+    tmpunits = copy_units(cinfo, units);
 
     if (tmpunits == NULL) {
         br_error("br_add_ul_cmd", "malloc");
         return -1;
     }
 
+    if (br_add_ul_cmd_take(cinfo, cmd, tmpunits) < 0) {
+        tmperrno = errno;
+        br_free_unit_list(tmpunits);
+        errno = tmperrno;
+        return -1;
+    }
+
+    return 0;
+}
+
+int br_add_ul_cmd_take(br_control_info *cinfo, int cmd, br_unit_list *units)
+{
+    /*
+     * Same as br_add_ul_cmd(), but without the copy: the control info
+     *  takes units over, and the caller mustn't touch or free it after.
+     *  units should come from br_new_cmd_unit_list() on this control info
+     *  (cheapest) or br_new_unit_list().
+     */
+
+    if (cinfo == NULL) {
+        errno = EINVAL;
+        br_error("br_add_ul_cmd_take", "NULL control info pointer");
+        return -1;
+    }
+
+    if (units == NULL) {
+        errno = EINVAL;
+        br_error("br_add_ul_cmd_take", "NULL unit list pointer");
+        return -1;
+    }
+
+    if (units->arena && (units->arena != cinfo->arena)) {
+        errno = EINVAL;
+        br_error("br_add_ul_cmd_take", "Unit list belongs to another control info");
+        return -1;
+    }
+
     if (cinfo->numcmds >= cinfo->allocatedcmds) {
-        if (br_realloc_cmds(cinfo, cinfo->numcmds + CMD_BLKSIZE) < 0) {
-            br_free_unit_list(tmpunits);
+        if (br_realloc_cmds(cinfo, cinfo->allocatedcmds ?
+          cinfo->allocatedcmds * 2:CMD_BLKSIZE) < 0)
             return -1;
-        }
     }
 
     cinfo->cmds[cinfo->numcmds] = cmd;
-    cinfo->units[cinfo->numcmds] = tmpunits;
+    cinfo->units[cinfo->numcmds] = units;
+
+    if (units->arena == NULL)
+        cinfo->heaplists++;
 
     cinfo->numcmds++;
 
     return 0;
 }
 
+int br_add_ul_cmd_grouped(br_control_info *cinfo, int cmd,
+  br_unit_list *units)
+{
+    /*
+     * Same as br_add_ul_cmd(), except that for OFF, housecodes given as
+     *  wildcards ("B*"; see br_strtoul()) each go out as one ALL_OFF
+     *  instead of an OFF to all sixteen units.  The rest of the units (if
+     *  any) get cmd as usual.  ON is left alone: ALL_ON only turns on
+     *  lamps (appliance modules ignore it), so it isn't the same thing.
+     */
+
+    br_unit_list *rest;
+    br_unit_set grouped;
+    int house;
+
+
+    if ((cinfo == NULL) || (units == NULL)) {
+        errno = EINVAL;
+        br_error("br_add_ul_cmd_grouped", "NULL pointer");
+        return -1;
+    }
+
+    if ((cmd != OFF) || !units->wild)
+        return br_add_ul_cmd(cinfo, cmd, units);
+
+    br_us_clear(&grouped);
+
+    if ((rest = copy_units(cinfo, units)) == NULL) {
+        br_error("br_add_ul_cmd_grouped", "malloc");
+        return -1;
+    }
+
+    for (house = 0; house < 16; house++) {
+        if (!(units->wild & (1 << house))
+          || !br_us_house_full(&units->set, house))
+            continue;
+
+        if (br_add_cmd(cinfo, ALL_OFF, house, 0) < 0) {
+            br_free_unit_list(rest);
+            return -1;
+        }
+
+        br_us_add_range(&grouped, BR_UNIT(house, 0), BR_UNIT(house, 15));
+    }
+
+    br_us_diff(&rest->set, &rest->set, &grouped);
+    rest->numunits = br_us_count(&rest->set);
+    rest->wild = 0;
+
+    if (rest->numunits == 0) {
+        br_free_unit_list(rest);
+        return 0;
+    }
+
+    if (br_add_ul_cmd_take(cinfo, cmd, rest) < 0) {
+        br_free_unit_list(rest);
+        return -1;
+    }
+
+    return 0;
+}
+
 int br_add_cmd(br_control_info *cinfo, int cmd, int house, int dev)
 {
     br_unit_list *units;
     int tmperrno;
 
 
-    units = br_new_unit_list();
+    units = br_new_cmd_unit_list(cinfo);
 
     if (units == NULL)
         return -1;
 
-    if (br_add_unit(units, house, dev) < 0) {
-        tmperrno = errno;
-        br_free_unit_list(units);
-        errno = tmperrno;
-        return -1;
-    }
-
-    if (br_add_ul_cmd(cinfo, cmd, units) < 0) {
+    if ((br_add_unit(units, house, dev) < 0)
+      || (br_add_ul_cmd_take(cinfo, cmd, units) < 0))
+    {
         tmperrno = errno;
         br_free_unit_list(units);
         errno = tmperrno;
         return -1;
     }
 
-    br_free_unit_list(units);
-
     return 0;
 }
 
@@ -577,6 +704,9 @@ int br_del_cmd(br_control_info *cinfo, int index)
         return 0;
     }
 
+    if (cinfo->units[index]->arena == NULL)
+        cinfo->heaplists--;
+
     br_free_unit_list(cinfo->units[index]);
     cinfo->units[index] = NULL;
 
@@ -590,16 +720,49 @@ int br_del_cmd(br_control_info *cinfo, int index)
     return 0;
 }
 
+#define BLANK(c)     (((c) == ' ') || ((c) == '\t'))
+#define HOUSELTR(c)  ((((c) | 0x20) >= 'a') && (((c) | 0x20) <= 'p'))
+#define DIGIT(c)     (((c) >= '0') && ((c) <= '9'))
+
+static char *scan_dev(char *p, int *dev)
+{
+/*
+ * A device number, 1 to 16; NULL if there isn't one
+ */
+
+    if (!DIGIT(*p))
+        return NULL;
+
+    for (*dev = 0; DIGIT(*p) && (*dev <= 16); p++)
+        *dev = *dev * 10 + (*p - '0');
+
+    if ((*dev < 1) || (*dev > 16))
+        return NULL;
+
+    return p;
+}
+
 int br_strtoul(char *ulptr, br_unit_list *units, char **endptr)
 {
-    int house;
-    int tmphouse;
-    int dev;
-    char *my_endptr = NULL;
-    char *last_endptr = ulptr;
+/*
+ * Read a list of units in one pass, straight into the set: "A1,3",
+ *  "A1-8", "B*", "C2,4-6,D1", with blanks allowed between the parts.  A
+ *  housecode carries on to the units after it; with none, it's the
+ *  context's default_house (br_default_house, normally).  "B*" is all of
+ *  housecode B, and is noted in units->wild as well.
+ *
+ * *endptr ends up after the list; there can be more after it, as with
+ *  strtol().  If the list itself is bad, it's left on the character at
+ *  fault, the list is left empty and -1 comes back.  endptr can be NULL.
+ */
 
+    char *p = ulptr;
+    char *what;
+    char msg[128];
+    int house = BR_CTX->default_house;
+    int first;
+    int last;
 
-    house = br_default_house;
 
     if (units == NULL) {
         errno = EINVAL;
@@ -609,64 +772,115 @@ int br_strtoul(char *ulptr, br_unit_list *units, char **endptr)
 
     /* Get rid of any residue */
 
-    if (units->devs)
-        free(units->devs);
+    br_us_clear(&units->set);
+    memset(units->last, 0, sizeof(units->last));
+    units->wild = 0;
 
-    if (units->houses)
-        free(units->houses);
+    for (;;) {
+        while (BLANK(*p))
+            p++;
 
-    units->devs = NULL;
-    units->houses = NULL;
-    units->allocatedunits = 0;
-    units->numunits = 0;
+        if (HOUSELTR(*p)) {
+            house = (*p++ | 0x20) - 'a';
 
-    do {
-        while (isspace(*ulptr))
-            ulptr++;
+            while (BLANK(*p))
+                p++;
+        }
 
-        tmphouse = br_strtohc(ulptr, &ulptr);
+        if (*p == '*') {
+            br_us_add_range(&units->set, BR_UNIT(house, 0),
+              BR_UNIT(house, 15));
+            units->wild |= 1 << house;
+            units->last[house] = 16;
+            p++;
+        } else {
+            if ((p = scan_dev(what = p, &first)) == NULL) {
+                p = what;
+                what = "Expected a device number (1-16) or '*'";
+                goto bad;
+            }
 
-        if (tmphouse >= 0)
-            house = tmphouse;
+            last = first;
 
-        last_endptr = ulptr;
+            while (BLANK(*p))
+                p++;
 
-        while (isspace(*ulptr))
-            ulptr++;
+            if (*p == '-') {
+                p++;
 
-        dev = (int)strtol(ulptr, &my_endptr, 0);
+                while (BLANK(*p))
+                    p++;
 
-        if ((dev > 16) || (dev < 1))
-        {
-            errno = EINVAL;
-            br_error("br_strtoul", "Bad device number");
-            return -1;
-        }
+                /*
+                 * "A1-A8" is fine too, as long as it's the same letter
+                 */
 
-        last_endptr = ulptr;
+                if (HOUSELTR(*p)) {
+                    if ((*p | 0x20) - 'a' != house) {
+                        what = "Range goes across housecodes";
+                        goto bad;
+                    }
 
-        while (isspace(*my_endptr))
-            my_endptr++;
+                    p++;
+                }
 
-        ulptr = my_endptr;
+                if ((p = scan_dev(what = p, &last)) == NULL) {
+                    p = what;
+                    what = "Expected a device number (1-16)";
+                    goto bad;
+                }
+
+                if (last < first) {
+                    p = what;
+                    what = "Range ends before it starts";
+                    goto bad;
+                }
+            }
 
-        if ((*my_endptr != '\0') && (*my_endptr != ',')) {
-            *endptr = last_endptr;
-            return 0;
+            br_us_add_range(&units->set, BR_UNIT(house, first - 1),
+              BR_UNIT(house, last - 1));
+            units->last[house] = last;
         }
 
-        if (br_add_unit(units, house, dev - 1) < 0)
-            return -1;
-    } while (*ulptr++);
+        what = p;
+
+        while (BLANK(*p))
+            p++;
+
+        if (*p != ',') {
+            p = what;
+            break;
+        }
+
+        p++;
+    }
+
+    units->numunits = br_us_count(&units->set);
 
-    *endptr = --ulptr;
+    if (endptr)
+        *endptr = p;
 
     return 0;
+
+bad:
+    if (endptr)
+        *endptr = p;
+
+    br_us_clear(&units->set);
+    memset(units->last, 0, sizeof(units->last));
+    units->numunits = 0;
+    units->wild = 0;
+    errno = EINVAL;
+    sprintf(msg, "%s, at character %d of \"%.20s\"", what,
+      (int)(p - ulptr) + 1, ulptr);
+    br_error("br_strtoul", msg);
+
+    return -1;
 }
 
 int br_ulcat(br_unit_list *a, br_unit_list *b)
 {
-    register int i;
+    register int h;
 
 
     if ((a == NULL) || (b == NULL)) {
@@ -675,18 +889,26 @@ int br_ulcat(br_unit_list *a, br_unit_list *b)
         return -1;
     }
 
-    for (i = 0; i < b->numunits; i++) {
-        if (br_add_unit(a, b->houses[i], b->devs[i]) < 0)
-            return -1;
+    /*
+     * b's units come after a's, so b decides what goes last wherever it
+     *  has any
+     */
+
+    for (h = 0; h < 16; h++) {
+        if (br_ul_last(b, h) >= 0)
+            a->last[h] = BR_UNIT_DEV(br_ul_last(b, h)) + 1;
     }
 
+    br_us_union(&a->set, &a->set, &b->set);
+    a->numunits = br_us_count(&a->set);
+    a->wild |= b->wild;
+
     return 0;
 }
 
 br_unit_list *br_uldup(br_unit_list *a)
 {
     br_unit_list *units;
-    register int i;
 
 
     units = br_new_unit_list();
@@ -694,42 +916,105 @@ br_unit_list *br_uldup(br_unit_list *a)
     if (units == NULL)
         return NULL;
 
+    br_ul_copy(units, a);
 
-    if (a->allocatedunits) {
-        units->devs = malloc(sizeof(int) * a->allocatedunits);
+    return units;
+}
 
-        if (units->devs == NULL) {
-            br_error("br_uldup", "malloc");
-            return NULL;
-        }
+void br_ul_copy(br_unit_list *to, const br_unit_list *from)
+{
+    /*
+     * Everything but where the list lives
+     */
 
-#ifdef MEM_DEBUG
-        printf("br_dldup: Malloced %d bytes at %lx\n",
-          sizeof(int) * a->allocatedunits, devs->devs);
-#endif
+    to->set = from->set;
+    to->numunits = from->numunits;
+    to->wild = from->wild;
+    memcpy(to->last, from->last, sizeof(to->last));
+}
 
-        units->houses = malloc(sizeof(int) * a->allocatedunits);
+int br_ul_last(const br_unit_list *units, int house)
+{
+/*
+ * The unit that goes out last in a housecode, or -1 if the list has
+ *  none there
+ */
 
-        if (units->houses == NULL) {
-            br_error("br_uldup", "malloc");
-            return NULL;
-        }
+    int u;
+    int last = -1;
 
- #ifdef MEM_DEBUG
-        printf("br_dldup: Malloced %d bytes at %lx\n",
-          sizeof(int) * a->allocatedunits, devs->houses);
-#endif
 
-        for (i = 0; i < a->numunits; i++) {
-            units->devs[i] = a->devs[i];
-            units->houses[i] = a->houses[i];
-        }
+    if (units->last[house]) {
+        u = BR_UNIT(house, units->last[house] - 1);
+
+        if (br_us_test(&units->set, u))
+            return u;
     }
 
-    units->numunits = a->numunits;
-    units->allocatedunits = a->allocatedunits;
+    for (u = br_us_next(&units->set, BR_UNIT(house, 0) - 1);
+      (u >= 0) && (BR_UNIT_HOUSE(u) == house); u = br_us_next(&units->set, u))
+        last = u;
 
-    return units;
+    return last;
+}
+
+static int ul_enter(const br_unit_list *units, int u)
+{
+    /*
+     * u is the first unit in its housecode; if it has to wait for the
+     *  end, start with the one after it instead
+     */
+
+    int next;
+
+
+    if ((u < 0) || (u != br_ul_last(units, BR_UNIT_HOUSE(u))))
+        return u;
+
+    next = br_us_next(&units->set, u);
+
+    return ((next >= 0) && (BR_UNIT_HOUSE(next) == BR_UNIT_HOUSE(u))) ?
+      next:u;
+}
+
+int br_ul_next(const br_unit_list *units, int u)
+{
+/*
+ * Walk a unit list in the order it goes out: by address, except that in
+ *  each housecode the device given last comes after all the others
+ *  there.  -1 to start; returns -1 at the end.
+ */
+
+    int house;
+    int last;
+    int next;
+
+
+    if (u < 0)
+        return ul_enter(units, br_us_next(&units->set, -1));
+
+    house = BR_UNIT_HOUSE(u);
+    last = br_ul_last(units, house);
+
+    if (u == last) {
+
+        /*
+         * That's the housecode done
+         */
+
+        return (house == 15) ? -1
+          :ul_enter(units, br_us_next(&units->set, BR_UNIT(house + 1, 0) - 1));
+    }
+
+    next = br_us_next(&units->set, u);
+
+    if (next == last)
+        next = br_us_next(&units->set, next);
+
+    if ((next < 0) || (BR_UNIT_HOUSE(next) != house))
+        return last;
+
+    return next;
 }
 
 int br_strtohc(char *hcptr, char **endptr)
@@ -760,24 +1045,30 @@ int br_strtohc(char *hcptr, char **endptr)
 
 int br_get_ul_device(br_unit_list *units, int index)
 {
+    int unit;
+
+
     if (units == NULL)
         return -1;
 
-    if (index >= units->numunits)
+    if ((unit = br_us_nth(&units->set, index)) < 0)
         return -1;
 
-    return units->devs[index];
+    return BR_UNIT_DEV(unit);
 }
 
 int br_get_ul_house(br_unit_list *units, int index)
 {
+    int unit;
+
+
     if (units == NULL)
         return -1;
 
-    if (index > units->numunits)
+    if ((unit = br_us_nth(&units->set, index)) < 0)
         return -1;
 
-    return units->houses[index];
+    return BR_UNIT_HOUSE(unit);
 }
 
 int br_get_num_units(br_unit_list *units)
@@ -788,6 +1079,86 @@ int br_get_num_units(br_unit_list *units)
     return units->numunits;
 }
 
+int br_set_copies(br_control_info *cinfo, int cmd, int copies)
+{
+/*
+ * Send each frame of every cmd in the list this many times.  Only
+ *  commands that leave things the same however often they're heard can
+ *  be sent more than once: a second DIM dims twice.
+ */
+
+    if (cinfo == NULL) {
+        errno = EINVAL;
+        br_error("br_set_copies", "NULL control info pointer");
+        return -1;
+    }
+
+    if ((cmd < ON) || (cmd >= BR_NUM_CMDS) || (copies < 0)
+      || (copies > BR_MAX_COPIES))
+    {
+        errno = EINVAL;
+        br_error("br_set_copies", "Invalid command or number of copies");
+        return -1;
+    }
+
+    if ((ISDIMCMD(cmd) || (cmd == PAUSE)) && (copies > 1)) {
+        errno = EINVAL;
+        br_error("br_set_copies", "Dims, brights and pauses only go once");
+        return -1;
+    }
+
+    cinfo->retx.copies[cmd] = copies;
+
+    return 0;
+}
+
+int br_set_spread(br_control_info *cinfo, int frames)
+{
+/*
+ * How many of the frames after it a copy can be left behind; 0 sends
+ *  copies straight after their original
+ */
+
+    if ((cinfo == NULL) || (frames < 0)) {
+        errno = EINVAL;
+        br_error("br_set_spread", "NULL pointer or negative spread");
+        return -1;
+    }
+
+    cinfo->retx.spread = frames;
+
+    return 0;
+}
+
+int br_set_default_copies(br_control_info *cinfo)
+{
+/*
+ * More copies of the commands it matters most to get heard (everything
+ *  off), fewer of the rest, none of dims
+ */
+
+    return ((br_set_copies(cinfo, ALL_OFF, 3) < 0)
+      || (br_set_copies(cinfo, ALL_LAMPS_OFF, 3) < 0)
+      || (br_set_copies(cinfo, ON, 2) < 0)
+      || (br_set_copies(cinfo, OFF, 2) < 0)
+      || (br_set_copies(cinfo, ALL_ON, 2) < 0)
+      || (br_set_copies(cinfo, ALL_LAMPS_ON, 2) < 0)
+      || (br_set_spread(cinfo, 2) < 0)) ? -1:0;
+}
+
+int br_has_copies(br_control_info *cinfo)
+{
+    register int i;
+
+
+    for (i = 0; i < BR_NUM_CMDS; i++) {
+        if (cinfo->retx.copies[i] > 1)
+            return 1;
+    }
+
+    return 0;
+}
+
 int br_get_num_commands(br_control_info *cinfo)
 {
     if (cinfo == NULL)
@@ -796,6 +1167,43 @@ int br_get_num_commands(br_control_info *cinfo)
     return cinfo->numcmds;
 }
 
+/*
+ * The same, in a given context rather than the thread's own
+ */
+
+int br_execute_ctx(br_context *ctx, int fd, br_control_info *cinfo)
+{
+    br_context *old = br_use_context(ctx);
+    int rv;
+    int tmperrno;
+
+
+    rv = br_execute(fd, cinfo);
+
+    tmperrno = errno;
+    br_use_context(old);
+    errno = tmperrno;
+
+    return rv;
+}
+
+int br_strtoul_ctx(br_context *ctx, char *ulptr, br_unit_list *units,
+  char **endptr)
+{
+    br_context *old = br_use_context(ctx);
+    int rv;
+    int tmperrno;
+
+
+    rv = br_strtoul(ulptr, units, endptr);
+
+    tmperrno = errno;
+    br_use_context(old);
+    errno = tmperrno;
+
+    return rv;
+}
+
 #ifdef __cplusplus
 }
 #endif
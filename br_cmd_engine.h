@@ -1,25 +1,81 @@
 #ifndef _CMD_HANDLING_H
 #define _CMD_HANDLING_H
 
-#define CMD_BLKSIZE 64   /* How many commands should we allocate space for at a time? */
-#define UNIT_BLKSIZE 5    /*  How many units in a command allocated at a time */
+#include "br_cmd.h"
+#include "br_arena.h"
+#include "br_units.h"
+
+#define CMD_BLKSIZE 64   /* How many commands should we allocate space for at first? */
+
+#define BR_NUM_CMDS  9     /* ON through PAUSE (see br_cmd.h) */
+#define BR_MAX_COPIES 8    /* most times one command's frames can go out */
+
+/*
+ * A unit list is a set: each unit is in it once, and they come out in
+ *  order (see br_units.h) -- except that in each housecode, the device
+ *  given last goes out last, since that's the one a DIM or BRIGHT after
+ *  the list acts on (see br_ul_next())
+ */
 
 typedef struct {
     int numunits;
-    int allocatedunits;
-    int *devs;
-    int *houses;
+    br_unit_set set;
+    unsigned char last[16];  /* per housecode, device given last + 1, or 0
+                              *  for plain order */
+    unsigned int wild;  /* housecodes given as "B*" (a bit each; see
+                         *  br_strtoul() and br_add_ul_cmd_grouped()) */
+    br_arena *arena;    /* where the list lives; NULL if malloc()ed */
 } br_unit_list;
 
+/*
+ * How many copies of each kind of command go out, and how far behind
+ *  its original a copy is allowed to fall (in frames).  Copies are
+ *  spread between the frames that follow instead of waiting for the
+ *  whole list to go round again like repeat does (see br_compile()).
+ *  0 and 1 both mean just the once.
+ */
+
+typedef struct {
+    int copies[BR_NUM_CMDS];
+    int spread;
+} br_retransmit;
+
 typedef struct {
     int inverse;
     int repeat;
+    br_retransmit retx;
+    int stream;         /* send frames back-to-back (see br_stream_begin()) */
+    int priority;       /* BR_PRI_*; only engines (br_async.c) care */
+    int gap;            /* between back-to-back frames, uSec; -1 for the
+                         *  context's inter_frame_delay */
     int numcmds;
     int allocatedcmds;
     br_unit_list **units;
     int *cmds;
+    br_arena *arena;    /* holds the command and unit lists */
+    int heaplists;      /* unit lists handed over that aren't in it */
 } br_control_info;
 
+/*
+ * How urgent a command list is.  An engine goes on with the most urgent
+ *  list it has every time a frame is done (see br_submit()).
+ */
+
+#define BR_PRI_EMERGENCY    0
+#define BR_PRI_INTERACTIVE  1
+#define BR_PRI_BULK         2
+#define BR_NUM_PRIS         3
+
+/*
+ * What br_optimize() managed to save, per pass through the command list
+ */
+
+typedef struct {
+    int frames_before;
+    int frames_after;
+    long usecs_saved;
+} br_opt_stats;
+
 int br_inverse_cmd(int /* command */);
 int br_set_fd(br_control_info *, int /* file descriptor */);
 int br_execute(int fd, br_control_info *);
@@ -32,6 +88,11 @@ int br_realloc_cmds(br_control_info *, int /* number of commands */);
 int br_free_cmds(br_control_info *);
 int br_add_ul_cmd(br_control_info *, int /* command */,
                br_unit_list * /* units */);
+int br_add_ul_cmd_take(br_control_info *, int /* command */,
+               br_unit_list * /* units */);
+int br_add_ul_cmd_grouped(br_control_info *, int /* command */,
+               br_unit_list * /* units */);
+br_unit_list *br_new_cmd_unit_list(br_control_info *);
 int br_add_cmd(br_control_info *, int /* command */, int /* house */,
                int /* device */);
 int br_del_cmd(br_control_info *, int /* command index */);
@@ -40,12 +101,25 @@ int br_free_control_info(br_control_info *);
 int br_strtoul(char * /* dlptr */, br_unit_list * /* units */, char ** /* endptr */);
 int br_ulcat(br_unit_list * /* units a */, br_unit_list * /* units b */);
 br_unit_list *br_uldup(br_unit_list * /* units */);
+int br_ul_next(const br_unit_list *, int /* after this unit, -1 to start */);
+int br_ul_last(const br_unit_list *, int /* house */);
+void br_ul_copy(br_unit_list * /* to */, const br_unit_list * /* from */);
 int br_strtohc(char * /* hcptr */, char ** /* endptr */);
 int br_get_num_commands(br_control_info *);
 int br_get_ul_device(br_unit_list * /* units */, int /* index */);
 int br_get_ul_house(br_unit_list * /* units */, int /* index */);
 int br_get_num_units(br_unit_list * /* units */);
+int br_optimize(br_control_info *, br_opt_stats * /* stats */);
+int br_set_copies(br_control_info *, int /* command */, int /* copies */);
+int br_set_spread(br_control_info *, int /* frames */);
+int br_set_default_copies(br_control_info *);
+int br_has_copies(br_control_info *);
+int br_execute_ctx(br_context *, int /* file desc */, br_control_info *);
+int br_strtoul_ctx(br_context *, char * /* dlptr */, br_unit_list * /* units */,
+               char ** /* endptr */);
 
-extern int br_default_house;
+/*
+ * br_default_house lives in the default context now (see br_cmd.h)
+ */
 
 #endif
\ No newline at end of file
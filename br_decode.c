@@ -0,0 +1,304 @@
+/*
+ * br_decode.c -- A reference decoder for BottleRocket's output: reads
+ *  DTR/RTS transitions (from the virtual or a capture backend) and works
+ *  out which frames they carry, and how well they were timed.
+ *  (c) 1999 by Tymm Twillman (tymm@acm.org).
+ *
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ */
+
+#ifdef __cplusplus
+extern C {
+#endif
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#endif
+
+#include "br_cmd.h"
+#include "br_plan.h"
+#include "br_backend.h"
+#include "br_decode.h"
+
+#define DECODE_BLKSIZE 64        /* decoded frames allocated at a time */
+
+#define CLOCK_LINES (TIOCM_FOR_0 | TIOCM_FOR_1)
+#define FRAME_BITS  (BR_FRAME_LEN * 8)
+
+
+void br_decode_init_opts(br_decode_opts *opts)
+{
+    /*
+     * Expect whatever we'd send right now, give or take a quarter
+     */
+
+    opts->half_bit = BR_CTX->inter_bit_delay;
+    opts->tolerance = BR_CTX->inter_bit_delay / 4;
+    opts->min_hold = 0;
+}
+
+int br_decode_frame(const unsigned char *bytes, int *unit, int *cmd)
+{
+/*
+ * Map the middle two bytes of a frame back to a unit and command.  Only
+ *  ON and OFF care about the device; everything else is matched with
+ *  device bits of 0, the way br_compile() sends them, which keeps the
+ *  answer unique.
+ */
+
+    register int house;
+    register int dev;
+    register int c;
+    const unsigned char *try;
+
+
+    for (house = 0; house < 16; house++) {
+        if ((BR_FRAME_BYTES(house << 4, ON)[2] & 0xf0) == (bytes[2] & 0xf0))
+            break;
+    }
+
+    if (house == 16) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    for (c = 0; c < PAUSE; c++) {
+        for (dev = 0; dev < (CMDHASDEVS(c) ? 16:1); dev++) {
+            try = BR_FRAME_BYTES((house << 4) | dev, c);
+
+            if ((try[2] == bytes[2]) && (try[3] == bytes[3])) {
+                *unit = (house << 4) | dev;
+                *cmd = c;
+                return 0;
+            }
+        }
+    }
+
+    errno = EINVAL;
+
+    return -1;
+}
+
+static void check_half_bit(const br_decode_opts *opts, br_decoded *frame,
+  long usecs)
+{
+    long error = usecs - opts->half_bit;
+
+
+    if (labs(error) > labs(frame->worst_error))
+        frame->worst_error = error;
+
+    if (labs(error) > opts->tolerance) {
+        frame->timing_errors++;
+        frame->status |= BR_DECODE_TIMING;
+    }
+}
+
+static void finish_frame(br_decoded *frame)
+{
+    if (frame->numbits < FRAME_BITS) {
+        frame->status |= BR_DECODE_SHORT;
+        return;
+    }
+
+    if ((frame->bytes[0] != 0xd5) || (frame->bytes[1] != 0xaa))
+        frame->status |= BR_DECODE_BAD_HEADER;
+
+    if (frame->bytes[4] != 0xad)
+        frame->status |= BR_DECODE_BAD_FOOTER;
+
+    if (br_decode_frame(frame->bytes, &frame->unit, &frame->cmd) < 0)
+        frame->status |= BR_DECODE_UNKNOWN;
+}
+
+int br_decode(const br_transition *trans, int numtrans,
+  const br_decode_opts *opts, br_decoded **framesp)
+{
+/*
+ * Walk through the transitions as the receiver would.  With both lines
+ *  up it's "clock"; dropping one of them is a bit (DTR down for a 1, RTS
+ *  down for a 0 -- see bits_out() in br_cmd.c), and both coming back up
+ *  finishes the bit.  A frame starts with the first bit after a clock
+ *  hold and ends after 40 bits, or when the lines go anywhere else.
+ *
+ * Returns how many frames were found; *framesp gets an array of them
+ *  (to be free()d), or NULL if there weren't any.
+ */
+
+    br_decode_opts defaults;
+    br_decoded *frames = NULL;
+    br_decoded *tmp;
+    br_decoded *frame = NULL;
+    int numframes = 0;
+    int allocated = 0;
+    int lines = 0;
+    int prev;
+    long since = 0;
+    long usecs;
+    register int i;
+
+
+    if ((trans == NULL && numtrans) || (framesp == NULL)) {
+        errno = EINVAL;
+        br_error("br_decode", "NULL pointer");
+        return -1;
+    }
+
+    if (opts == NULL) {
+        br_decode_init_opts(&defaults);
+        opts = &defaults;
+    }
+
+    for (i = 0; i < numtrans; i++) {
+        prev = lines;
+        lines = trans[i].lines & CLOCK_LINES;
+
+        if (lines == prev)
+            continue;       /* nothing the receiver would notice */
+
+        usecs = trans[i].when - since;
+        since = trans[i].when;
+
+        if ((prev == CLOCK_LINES) && lines) {
+
+            /*
+             * One line dropped: a bit, and maybe a new frame
+             */
+
+            if (frame == NULL) {
+                if (numframes >= allocated) {
+                    tmp = realloc(frames,
+                      (allocated + DECODE_BLKSIZE) * sizeof(br_decoded));
+
+                    if (tmp == NULL) {
+                        br_error("br_decode", "realloc");
+                        free(frames);
+                        return -1;
+                    }
+
+                    frames = tmp;
+                    allocated += DECODE_BLKSIZE;
+                }
+
+                frame = &frames[numframes++];
+                memset(frame, 0, sizeof(br_decoded));
+                frame->start = trans[i].when;
+                frame->hold = usecs;
+                frame->unit = -1;
+                frame->cmd = -1;
+
+                if (opts->min_hold && (usecs < opts->min_hold))
+                    frame->status |= BR_DECODE_SHORT_HOLD;
+            } else {
+                check_half_bit(opts, frame, usecs);
+            }
+
+            frame->bytes[frame->numbits / 8] <<= 1;
+
+            if (lines == TIOCM_FOR_1)
+                frame->bytes[frame->numbits / 8] |= 1;
+
+            frame->numbits++;
+        } else if (frame && (prev != CLOCK_LINES) && (lines == CLOCK_LINES)) {
+
+            /*
+             * Back to clock: that's the end of a bit
+             */
+
+            check_half_bit(opts, frame, usecs);
+
+            if (frame->numbits == FRAME_BITS) {
+                frame->end = trans[i].when;
+                finish_frame(frame);
+                frame = NULL;
+            }
+        } else if (frame) {
+
+            /*
+             * Anything else in the middle of a frame is the end of it
+             */
+
+            frame->end = trans[i].when;
+            finish_frame(frame);
+            frame = NULL;
+        }
+    }
+
+    if (frame) {
+        frame->end = since;
+        finish_frame(frame);
+    }
+
+    *framesp = frames;
+
+    return numframes;
+}
+
+int br_decode_compare(const br_decoded *frames, int numframes, br_plan *plan)
+{
+/*
+ * Check decoded frames against what the plan should have sent, in order.
+ *  Returns how many frames were wrong, missing or extra (so 0 is a
+ *  perfect round trip).  Any problem flagged by the decoder counts as
+ *  wrong, timing included.
+ */
+
+    br_plan_iter iter;
+    const br_frame *frame;
+    int wrong = 0;
+    int n = 0;
+
+
+    if (plan == NULL) {
+        errno = EINVAL;
+        br_error("br_decode_compare", "NULL plan pointer");
+        return -1;
+    }
+
+    br_plan_iter_init(&iter, plan);
+
+    while ((frame = br_plan_next(&iter)) != NULL) {
+        if (frame->cmd == PAUSE)
+            continue;       /* nothing goes out */
+
+        if (n >= numframes) {
+            wrong++;
+            continue;
+        }
+
+        if (frames[n].status
+          || memcmp(frames[n].bytes, frame->bytes, BR_FRAME_LEN))
+            wrong++;
+
+        n++;
+    }
+
+    return wrong + (numframes - n);
+}
+
+#ifdef __cplusplus
+}
+#endif
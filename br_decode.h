@@ -0,0 +1,71 @@
+#ifndef _BR_DECODE_H
+#define _BR_DECODE_H
+
+/*
+ * br_decode.h -- Turning recorded line transitions back into frames, the
+ *                way the FireCracker's receiver would see them.
+ *
+ * (c) 1999 Tymm Twillman (tymm@acm.org)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "br_plan.h"
+#include "br_backend.h"
+
+/*
+ * What's wrong with a decoded frame (0 if nothing)
+ */
+
+#define BR_DECODE_SHORT        0x01   /* lines let go of before 40 bits */
+#define BR_DECODE_BAD_HEADER   0x02   /* didn't start with 0xd5 0xaa */
+#define BR_DECODE_BAD_FOOTER   0x04   /* didn't end with 0xad */
+#define BR_DECODE_UNKNOWN      0x08   /* middle bytes aren't a command */
+#define BR_DECODE_TIMING       0x10   /* half-bits outside tolerance */
+#define BR_DECODE_SHORT_HOLD   0x20   /* not enough "clock" before it */
+
+/*
+ * How fussy to be; see br_decode_init_opts() for the defaults
+ */
+
+typedef struct {
+    long half_bit;        /* expected length of each half-bit, uSec */
+    long tolerance;       /* how far off a half-bit may be, uSec */
+    long min_hold;        /* least "clock" before a frame (0 = any) */
+} br_decode_opts;
+
+typedef struct {
+    long start;           /* first bit, uSec into the recording */
+    long end;             /* back to "clock" after the last bit */
+    long hold;            /* "clock" before the first bit */
+    unsigned char bytes[BR_FRAME_LEN];
+    int numbits;
+    int unit;             /* housecode << 4 | device, or -1 */
+    int cmd;              /* or -1 */
+    int status;           /* BR_DECODE_* */
+    int timing_errors;    /* half-bits outside tolerance */
+    long worst_error;     /* furthest off any half-bit was, uSec */
+} br_decoded;
+
+void br_decode_init_opts(br_decode_opts *);
+int br_decode(const br_transition *, int /* number of transitions */,
+              const br_decode_opts *, br_decoded ** /* frames */);
+int br_decode_frame(const unsigned char * /* bytes */, int * /* unit */,
+              int * /* cmd */);
+int br_decode_compare(const br_decoded *, int /* number of frames */,
+              br_plan *);
+
+#endif
@@ -0,0 +1,296 @@
+/*
+ * br_frames.c -- generated by mkframes from br_translate.h; don't edit.
+ */
+
+#include "br_plan.h"
+
+const unsigned char br_frame_table[16][16][9][BR_FRAME_LEN] = {
+  { /* A */
+    { {0xd5,0xaa,0x60,0x00,0xad},{0xd5,0xaa,0x60,0x20,0xad},{0xd5,0xaa,0x60,0x98,0xad},{0xd5,0xaa,0x60,0x88,0xad},{0xd5,0xaa,0x60,0x80,0xad},{0xd5,0xaa,0x60,0x91,0xad},{0xd5,0xaa,0x60,0x84,0xad},{0xd5,0xaa,0x60,0x94,0xad},{0xd5,0xaa,0x60,0x20,0xad} },
+    { {0xd5,0xaa,0x60,0x10,0xad},{0xd5,0xaa,0x60,0x30,0xad},{0xd5,0xaa,0x60,0x98,0xad},{0xd5,0xaa,0x60,0x98,0xad},{0xd5,0xaa,0x60,0x90,0xad},{0xd5,0xaa,0x60,0x91,0xad},{0xd5,0xaa,0x60,0x94,0xad},{0xd5,0xaa,0x60,0x94,0xad},{0xd5,0xaa,0x60,0x30,0xad} },
+    { {0xd5,0xaa,0x60,0x08,0xad},{0xd5,0xaa,0x60,0x28,0xad},{0xd5,0xaa,0x60,0x98,0xad},{0xd5,0xaa,0x60,0x88,0xad},{0xd5,0xaa,0x60,0x88,0xad},{0xd5,0xaa,0x60,0x99,0xad},{0xd5,0xaa,0x60,0x8c,0xad},{0xd5,0xaa,0x60,0x9c,0xad},{0xd5,0xaa,0x60,0x28,0xad} },
+    { {0xd5,0xaa,0x60,0x18,0xad},{0xd5,0xaa,0x60,0x38,0xad},{0xd5,0xaa,0x60,0x98,0xad},{0xd5,0xaa,0x60,0x98,0xad},{0xd5,0xaa,0x60,0x98,0xad},{0xd5,0xaa,0x60,0x99,0xad},{0xd5,0xaa,0x60,0x9c,0xad},{0xd5,0xaa,0x60,0x9c,0xad},{0xd5,0xaa,0x60,0x38,0xad} },
+    { {0xd5,0xaa,0x60,0x40,0xad},{0xd5,0xaa,0x60,0x60,0xad},{0xd5,0xaa,0x60,0xd8,0xad},{0xd5,0xaa,0x60,0xc8,0xad},{0xd5,0xaa,0x60,0xc0,0xad},{0xd5,0xaa,0x60,0xd1,0xad},{0xd5,0xaa,0x60,0xc4,0xad},{0xd5,0xaa,0x60,0xd4,0xad},{0xd5,0xaa,0x60,0x60,0xad} },
+    { {0xd5,0xaa,0x60,0x50,0xad},{0xd5,0xaa,0x60,0x70,0xad},{0xd5,0xaa,0x60,0xd8,0xad},{0xd5,0xaa,0x60,0xd8,0xad},{0xd5,0xaa,0x60,0xd0,0xad},{0xd5,0xaa,0x60,0xd1,0xad},{0xd5,0xaa,0x60,0xd4,0xad},{0xd5,0xaa,0x60,0xd4,0xad},{0xd5,0xaa,0x60,0x70,0xad} },
+    { {0xd5,0xaa,0x60,0x48,0xad},{0xd5,0xaa,0x60,0x68,0xad},{0xd5,0xaa,0x60,0xd8,0xad},{0xd5,0xaa,0x60,0xc8,0xad},{0xd5,0xaa,0x60,0xc8,0xad},{0xd5,0xaa,0x60,0xd9,0xad},{0xd5,0xaa,0x60,0xcc,0xad},{0xd5,0xaa,0x60,0xdc,0xad},{0xd5,0xaa,0x60,0x68,0xad} },
+    { {0xd5,0xaa,0x60,0x58,0xad},{0xd5,0xaa,0x60,0x78,0xad},{0xd5,0xaa,0x60,0xd8,0xad},{0xd5,0xaa,0x60,0xd8,0xad},{0xd5,0xaa,0x60,0xd8,0xad},{0xd5,0xaa,0x60,0xd9,0xad},{0xd5,0xaa,0x60,0xdc,0xad},{0xd5,0xaa,0x60,0xdc,0xad},{0xd5,0xaa,0x60,0x78,0xad} },
+    { {0xd5,0xaa,0x64,0x00,0xad},{0xd5,0xaa,0x64,0x20,0xad},{0xd5,0xaa,0x64,0x98,0xad},{0xd5,0xaa,0x64,0x88,0xad},{0xd5,0xaa,0x64,0x80,0xad},{0xd5,0xaa,0x64,0x91,0xad},{0xd5,0xaa,0x64,0x84,0xad},{0xd5,0xaa,0x64,0x94,0xad},{0xd5,0xaa,0x64,0x20,0xad} },
+    { {0xd5,0xaa,0x64,0x10,0xad},{0xd5,0xaa,0x64,0x30,0xad},{0xd5,0xaa,0x64,0x98,0xad},{0xd5,0xaa,0x64,0x98,0xad},{0xd5,0xaa,0x64,0x90,0xad},{0xd5,0xaa,0x64,0x91,0xad},{0xd5,0xaa,0x64,0x94,0xad},{0xd5,0xaa,0x64,0x94,0xad},{0xd5,0xaa,0x64,0x30,0xad} },
+    { {0xd5,0xaa,0x64,0x08,0xad},{0xd5,0xaa,0x64,0x28,0xad},{0xd5,0xaa,0x64,0x98,0xad},{0xd5,0xaa,0x64,0x88,0xad},{0xd5,0xaa,0x64,0x88,0xad},{0xd5,0xaa,0x64,0x99,0xad},{0xd5,0xaa,0x64,0x8c,0xad},{0xd5,0xaa,0x64,0x9c,0xad},{0xd5,0xaa,0x64,0x28,0xad} },
+    { {0xd5,0xaa,0x64,0x18,0xad},{0xd5,0xaa,0x64,0x38,0xad},{0xd5,0xaa,0x64,0x98,0xad},{0xd5,0xaa,0x64,0x98,0xad},{0xd5,0xaa,0x64,0x98,0xad},{0xd5,0xaa,0x64,0x99,0xad},{0xd5,0xaa,0x64,0x9c,0xad},{0xd5,0xaa,0x64,0x9c,0xad},{0xd5,0xaa,0x64,0x38,0xad} },
+    { {0xd5,0xaa,0x64,0x40,0xad},{0xd5,0xaa,0x64,0x60,0xad},{0xd5,0xaa,0x64,0xd8,0xad},{0xd5,0xaa,0x64,0xc8,0xad},{0xd5,0xaa,0x64,0xc0,0xad},{0xd5,0xaa,0x64,0xd1,0xad},{0xd5,0xaa,0x64,0xc4,0xad},{0xd5,0xaa,0x64,0xd4,0xad},{0xd5,0xaa,0x64,0x60,0xad} },
+    { {0xd5,0xaa,0x64,0x50,0xad},{0xd5,0xaa,0x64,0x70,0xad},{0xd5,0xaa,0x64,0xd8,0xad},{0xd5,0xaa,0x64,0xd8,0xad},{0xd5,0xaa,0x64,0xd0,0xad},{0xd5,0xaa,0x64,0xd1,0xad},{0xd5,0xaa,0x64,0xd4,0xad},{0xd5,0xaa,0x64,0xd4,0xad},{0xd5,0xaa,0x64,0x70,0xad} },
+    { {0xd5,0xaa,0x64,0x48,0xad},{0xd5,0xaa,0x64,0x68,0xad},{0xd5,0xaa,0x64,0xd8,0xad},{0xd5,0xaa,0x64,0xc8,0xad},{0xd5,0xaa,0x64,0xc8,0xad},{0xd5,0xaa,0x64,0xd9,0xad},{0xd5,0xaa,0x64,0xcc,0xad},{0xd5,0xaa,0x64,0xdc,0xad},{0xd5,0xaa,0x64,0x68,0xad} },
+    { {0xd5,0xaa,0x64,0x58,0xad},{0xd5,0xaa,0x64,0x78,0xad},{0xd5,0xaa,0x64,0xd8,0xad},{0xd5,0xaa,0x64,0xd8,0xad},{0xd5,0xaa,0x64,0xd8,0xad},{0xd5,0xaa,0x64,0xd9,0xad},{0xd5,0xaa,0x64,0xdc,0xad},{0xd5,0xaa,0x64,0xdc,0xad},{0xd5,0xaa,0x64,0x78,0xad} }
+  },
+  { /* B */
+    { {0xd5,0xaa,0x70,0x00,0xad},{0xd5,0xaa,0x70,0x20,0xad},{0xd5,0xaa,0x70,0x98,0xad},{0xd5,0xaa,0x70,0x88,0xad},{0xd5,0xaa,0x70,0x80,0xad},{0xd5,0xaa,0x70,0x91,0xad},{0xd5,0xaa,0x70,0x84,0xad},{0xd5,0xaa,0x70,0x94,0xad},{0xd5,0xaa,0x70,0x20,0xad} },
+    { {0xd5,0xaa,0x70,0x10,0xad},{0xd5,0xaa,0x70,0x30,0xad},{0xd5,0xaa,0x70,0x98,0xad},{0xd5,0xaa,0x70,0x98,0xad},{0xd5,0xaa,0x70,0x90,0xad},{0xd5,0xaa,0x70,0x91,0xad},{0xd5,0xaa,0x70,0x94,0xad},{0xd5,0xaa,0x70,0x94,0xad},{0xd5,0xaa,0x70,0x30,0xad} },
+    { {0xd5,0xaa,0x70,0x08,0xad},{0xd5,0xaa,0x70,0x28,0xad},{0xd5,0xaa,0x70,0x98,0xad},{0xd5,0xaa,0x70,0x88,0xad},{0xd5,0xaa,0x70,0x88,0xad},{0xd5,0xaa,0x70,0x99,0xad},{0xd5,0xaa,0x70,0x8c,0xad},{0xd5,0xaa,0x70,0x9c,0xad},{0xd5,0xaa,0x70,0x28,0xad} },
+    { {0xd5,0xaa,0x70,0x18,0xad},{0xd5,0xaa,0x70,0x38,0xad},{0xd5,0xaa,0x70,0x98,0xad},{0xd5,0xaa,0x70,0x98,0xad},{0xd5,0xaa,0x70,0x98,0xad},{0xd5,0xaa,0x70,0x99,0xad},{0xd5,0xaa,0x70,0x9c,0xad},{0xd5,0xaa,0x70,0x9c,0xad},{0xd5,0xaa,0x70,0x38,0xad} },
+    { {0xd5,0xaa,0x70,0x40,0xad},{0xd5,0xaa,0x70,0x60,0xad},{0xd5,0xaa,0x70,0xd8,0xad},{0xd5,0xaa,0x70,0xc8,0xad},{0xd5,0xaa,0x70,0xc0,0xad},{0xd5,0xaa,0x70,0xd1,0xad},{0xd5,0xaa,0x70,0xc4,0xad},{0xd5,0xaa,0x70,0xd4,0xad},{0xd5,0xaa,0x70,0x60,0xad} },
+    { {0xd5,0xaa,0x70,0x50,0xad},{0xd5,0xaa,0x70,0x70,0xad},{0xd5,0xaa,0x70,0xd8,0xad},{0xd5,0xaa,0x70,0xd8,0xad},{0xd5,0xaa,0x70,0xd0,0xad},{0xd5,0xaa,0x70,0xd1,0xad},{0xd5,0xaa,0x70,0xd4,0xad},{0xd5,0xaa,0x70,0xd4,0xad},{0xd5,0xaa,0x70,0x70,0xad} },
+    { {0xd5,0xaa,0x70,0x48,0xad},{0xd5,0xaa,0x70,0x68,0xad},{0xd5,0xaa,0x70,0xd8,0xad},{0xd5,0xaa,0x70,0xc8,0xad},{0xd5,0xaa,0x70,0xc8,0xad},{0xd5,0xaa,0x70,0xd9,0xad},{0xd5,0xaa,0x70,0xcc,0xad},{0xd5,0xaa,0x70,0xdc,0xad},{0xd5,0xaa,0x70,0x68,0xad} },
+    { {0xd5,0xaa,0x70,0x58,0xad},{0xd5,0xaa,0x70,0x78,0xad},{0xd5,0xaa,0x70,0xd8,0xad},{0xd5,0xaa,0x70,0xd8,0xad},{0xd5,0xaa,0x70,0xd8,0xad},{0xd5,0xaa,0x70,0xd9,0xad},{0xd5,0xaa,0x70,0xdc,0xad},{0xd5,0xaa,0x70,0xdc,0xad},{0xd5,0xaa,0x70,0x78,0xad} },
+    { {0xd5,0xaa,0x74,0x00,0xad},{0xd5,0xaa,0x74,0x20,0xad},{0xd5,0xaa,0x74,0x98,0xad},{0xd5,0xaa,0x74,0x88,0xad},{0xd5,0xaa,0x74,0x80,0xad},{0xd5,0xaa,0x74,0x91,0xad},{0xd5,0xaa,0x74,0x84,0xad},{0xd5,0xaa,0x74,0x94,0xad},{0xd5,0xaa,0x74,0x20,0xad} },
+    { {0xd5,0xaa,0x74,0x10,0xad},{0xd5,0xaa,0x74,0x30,0xad},{0xd5,0xaa,0x74,0x98,0xad},{0xd5,0xaa,0x74,0x98,0xad},{0xd5,0xaa,0x74,0x90,0xad},{0xd5,0xaa,0x74,0x91,0xad},{0xd5,0xaa,0x74,0x94,0xad},{0xd5,0xaa,0x74,0x94,0xad},{0xd5,0xaa,0x74,0x30,0xad} },
+    { {0xd5,0xaa,0x74,0x08,0xad},{0xd5,0xaa,0x74,0x28,0xad},{0xd5,0xaa,0x74,0x98,0xad},{0xd5,0xaa,0x74,0x88,0xad},{0xd5,0xaa,0x74,0x88,0xad},{0xd5,0xaa,0x74,0x99,0xad},{0xd5,0xaa,0x74,0x8c,0xad},{0xd5,0xaa,0x74,0x9c,0xad},{0xd5,0xaa,0x74,0x28,0xad} },
+    { {0xd5,0xaa,0x74,0x18,0xad},{0xd5,0xaa,0x74,0x38,0xad},{0xd5,0xaa,0x74,0x98,0xad},{0xd5,0xaa,0x74,0x98,0xad},{0xd5,0xaa,0x74,0x98,0xad},{0xd5,0xaa,0x74,0x99,0xad},{0xd5,0xaa,0x74,0x9c,0xad},{0xd5,0xaa,0x74,0x9c,0xad},{0xd5,0xaa,0x74,0x38,0xad} },
+    { {0xd5,0xaa,0x74,0x40,0xad},{0xd5,0xaa,0x74,0x60,0xad},{0xd5,0xaa,0x74,0xd8,0xad},{0xd5,0xaa,0x74,0xc8,0xad},{0xd5,0xaa,0x74,0xc0,0xad},{0xd5,0xaa,0x74,0xd1,0xad},{0xd5,0xaa,0x74,0xc4,0xad},{0xd5,0xaa,0x74,0xd4,0xad},{0xd5,0xaa,0x74,0x60,0xad} },
+    { {0xd5,0xaa,0x74,0x50,0xad},{0xd5,0xaa,0x74,0x70,0xad},{0xd5,0xaa,0x74,0xd8,0xad},{0xd5,0xaa,0x74,0xd8,0xad},{0xd5,0xaa,0x74,0xd0,0xad},{0xd5,0xaa,0x74,0xd1,0xad},{0xd5,0xaa,0x74,0xd4,0xad},{0xd5,0xaa,0x74,0xd4,0xad},{0xd5,0xaa,0x74,0x70,0xad} },
+    { {0xd5,0xaa,0x74,0x48,0xad},{0xd5,0xaa,0x74,0x68,0xad},{0xd5,0xaa,0x74,0xd8,0xad},{0xd5,0xaa,0x74,0xc8,0xad},{0xd5,0xaa,0x74,0xc8,0xad},{0xd5,0xaa,0x74,0xd9,0xad},{0xd5,0xaa,0x74,0xcc,0xad},{0xd5,0xaa,0x74,0xdc,0xad},{0xd5,0xaa,0x74,0x68,0xad} },
+    { {0xd5,0xaa,0x74,0x58,0xad},{0xd5,0xaa,0x74,0x78,0xad},{0xd5,0xaa,0x74,0xd8,0xad},{0xd5,0xaa,0x74,0xd8,0xad},{0xd5,0xaa,0x74,0xd8,0xad},{0xd5,0xaa,0x74,0xd9,0xad},{0xd5,0xaa,0x74,0xdc,0xad},{0xd5,0xaa,0x74,0xdc,0xad},{0xd5,0xaa,0x74,0x78,0xad} }
+  },
+  { /* C */
+    { {0xd5,0xaa,0x40,0x00,0xad},{0xd5,0xaa,0x40,0x20,0xad},{0xd5,0xaa,0x40,0x98,0xad},{0xd5,0xaa,0x40,0x88,0xad},{0xd5,0xaa,0x40,0x80,0xad},{0xd5,0xaa,0x40,0x91,0xad},{0xd5,0xaa,0x40,0x84,0xad},{0xd5,0xaa,0x40,0x94,0xad},{0xd5,0xaa,0x40,0x20,0xad} },
+    { {0xd5,0xaa,0x40,0x10,0xad},{0xd5,0xaa,0x40,0x30,0xad},{0xd5,0xaa,0x40,0x98,0xad},{0xd5,0xaa,0x40,0x98,0xad},{0xd5,0xaa,0x40,0x90,0xad},{0xd5,0xaa,0x40,0x91,0xad},{0xd5,0xaa,0x40,0x94,0xad},{0xd5,0xaa,0x40,0x94,0xad},{0xd5,0xaa,0x40,0x30,0xad} },
+    { {0xd5,0xaa,0x40,0x08,0xad},{0xd5,0xaa,0x40,0x28,0xad},{0xd5,0xaa,0x40,0x98,0xad},{0xd5,0xaa,0x40,0x88,0xad},{0xd5,0xaa,0x40,0x88,0xad},{0xd5,0xaa,0x40,0x99,0xad},{0xd5,0xaa,0x40,0x8c,0xad},{0xd5,0xaa,0x40,0x9c,0xad},{0xd5,0xaa,0x40,0x28,0xad} },
+    { {0xd5,0xaa,0x40,0x18,0xad},{0xd5,0xaa,0x40,0x38,0xad},{0xd5,0xaa,0x40,0x98,0xad},{0xd5,0xaa,0x40,0x98,0xad},{0xd5,0xaa,0x40,0x98,0xad},{0xd5,0xaa,0x40,0x99,0xad},{0xd5,0xaa,0x40,0x9c,0xad},{0xd5,0xaa,0x40,0x9c,0xad},{0xd5,0xaa,0x40,0x38,0xad} },
+    { {0xd5,0xaa,0x40,0x40,0xad},{0xd5,0xaa,0x40,0x60,0xad},{0xd5,0xaa,0x40,0xd8,0xad},{0xd5,0xaa,0x40,0xc8,0xad},{0xd5,0xaa,0x40,0xc0,0xad},{0xd5,0xaa,0x40,0xd1,0xad},{0xd5,0xaa,0x40,0xc4,0xad},{0xd5,0xaa,0x40,0xd4,0xad},{0xd5,0xaa,0x40,0x60,0xad} },
+    { {0xd5,0xaa,0x40,0x50,0xad},{0xd5,0xaa,0x40,0x70,0xad},{0xd5,0xaa,0x40,0xd8,0xad},{0xd5,0xaa,0x40,0xd8,0xad},{0xd5,0xaa,0x40,0xd0,0xad},{0xd5,0xaa,0x40,0xd1,0xad},{0xd5,0xaa,0x40,0xd4,0xad},{0xd5,0xaa,0x40,0xd4,0xad},{0xd5,0xaa,0x40,0x70,0xad} },
+    { {0xd5,0xaa,0x40,0x48,0xad},{0xd5,0xaa,0x40,0x68,0xad},{0xd5,0xaa,0x40,0xd8,0xad},{0xd5,0xaa,0x40,0xc8,0xad},{0xd5,0xaa,0x40,0xc8,0xad},{0xd5,0xaa,0x40,0xd9,0xad},{0xd5,0xaa,0x40,0xcc,0xad},{0xd5,0xaa,0x40,0xdc,0xad},{0xd5,0xaa,0x40,0x68,0xad} },
+    { {0xd5,0xaa,0x40,0x58,0xad},{0xd5,0xaa,0x40,0x78,0xad},{0xd5,0xaa,0x40,0xd8,0xad},{0xd5,0xaa,0x40,0xd8,0xad},{0xd5,0xaa,0x40,0xd8,0xad},{0xd5,0xaa,0x40,0xd9,0xad},{0xd5,0xaa,0x40,0xdc,0xad},{0xd5,0xaa,0x40,0xdc,0xad},{0xd5,0xaa,0x40,0x78,0xad} },
+    { {0xd5,0xaa,0x44,0x00,0xad},{0xd5,0xaa,0x44,0x20,0xad},{0xd5,0xaa,0x44,0x98,0xad},{0xd5,0xaa,0x44,0x88,0xad},{0xd5,0xaa,0x44,0x80,0xad},{0xd5,0xaa,0x44,0x91,0xad},{0xd5,0xaa,0x44,0x84,0xad},{0xd5,0xaa,0x44,0x94,0xad},{0xd5,0xaa,0x44,0x20,0xad} },
+    { {0xd5,0xaa,0x44,0x10,0xad},{0xd5,0xaa,0x44,0x30,0xad},{0xd5,0xaa,0x44,0x98,0xad},{0xd5,0xaa,0x44,0x98,0xad},{0xd5,0xaa,0x44,0x90,0xad},{0xd5,0xaa,0x44,0x91,0xad},{0xd5,0xaa,0x44,0x94,0xad},{0xd5,0xaa,0x44,0x94,0xad},{0xd5,0xaa,0x44,0x30,0xad} },
+    { {0xd5,0xaa,0x44,0x08,0xad},{0xd5,0xaa,0x44,0x28,0xad},{0xd5,0xaa,0x44,0x98,0xad},{0xd5,0xaa,0x44,0x88,0xad},{0xd5,0xaa,0x44,0x88,0xad},{0xd5,0xaa,0x44,0x99,0xad},{0xd5,0xaa,0x44,0x8c,0xad},{0xd5,0xaa,0x44,0x9c,0xad},{0xd5,0xaa,0x44,0x28,0xad} },
+    { {0xd5,0xaa,0x44,0x18,0xad},{0xd5,0xaa,0x44,0x38,0xad},{0xd5,0xaa,0x44,0x98,0xad},{0xd5,0xaa,0x44,0x98,0xad},{0xd5,0xaa,0x44,0x98,0xad},{0xd5,0xaa,0x44,0x99,0xad},{0xd5,0xaa,0x44,0x9c,0xad},{0xd5,0xaa,0x44,0x9c,0xad},{0xd5,0xaa,0x44,0x38,0xad} },
+    { {0xd5,0xaa,0x44,0x40,0xad},{0xd5,0xaa,0x44,0x60,0xad},{0xd5,0xaa,0x44,0xd8,0xad},{0xd5,0xaa,0x44,0xc8,0xad},{0xd5,0xaa,0x44,0xc0,0xad},{0xd5,0xaa,0x44,0xd1,0xad},{0xd5,0xaa,0x44,0xc4,0xad},{0xd5,0xaa,0x44,0xd4,0xad},{0xd5,0xaa,0x44,0x60,0xad} },
+    { {0xd5,0xaa,0x44,0x50,0xad},{0xd5,0xaa,0x44,0x70,0xad},{0xd5,0xaa,0x44,0xd8,0xad},{0xd5,0xaa,0x44,0xd8,0xad},{0xd5,0xaa,0x44,0xd0,0xad},{0xd5,0xaa,0x44,0xd1,0xad},{0xd5,0xaa,0x44,0xd4,0xad},{0xd5,0xaa,0x44,0xd4,0xad},{0xd5,0xaa,0x44,0x70,0xad} },
+    { {0xd5,0xaa,0x44,0x48,0xad},{0xd5,0xaa,0x44,0x68,0xad},{0xd5,0xaa,0x44,0xd8,0xad},{0xd5,0xaa,0x44,0xc8,0xad},{0xd5,0xaa,0x44,0xc8,0xad},{0xd5,0xaa,0x44,0xd9,0xad},{0xd5,0xaa,0x44,0xcc,0xad},{0xd5,0xaa,0x44,0xdc,0xad},{0xd5,0xaa,0x44,0x68,0xad} },
+    { {0xd5,0xaa,0x44,0x58,0xad},{0xd5,0xaa,0x44,0x78,0xad},{0xd5,0xaa,0x44,0xd8,0xad},{0xd5,0xaa,0x44,0xd8,0xad},{0xd5,0xaa,0x44,0xd8,0xad},{0xd5,0xaa,0x44,0xd9,0xad},{0xd5,0xaa,0x44,0xdc,0xad},{0xd5,0xaa,0x44,0xdc,0xad},{0xd5,0xaa,0x44,0x78,0xad} }
+  },
+  { /* D */
+    { {0xd5,0xaa,0x50,0x00,0xad},{0xd5,0xaa,0x50,0x20,0xad},{0xd5,0xaa,0x50,0x98,0xad},{0xd5,0xaa,0x50,0x88,0xad},{0xd5,0xaa,0x50,0x80,0xad},{0xd5,0xaa,0x50,0x91,0xad},{0xd5,0xaa,0x50,0x84,0xad},{0xd5,0xaa,0x50,0x94,0xad},{0xd5,0xaa,0x50,0x20,0xad} },
+    { {0xd5,0xaa,0x50,0x10,0xad},{0xd5,0xaa,0x50,0x30,0xad},{0xd5,0xaa,0x50,0x98,0xad},{0xd5,0xaa,0x50,0x98,0xad},{0xd5,0xaa,0x50,0x90,0xad},{0xd5,0xaa,0x50,0x91,0xad},{0xd5,0xaa,0x50,0x94,0xad},{0xd5,0xaa,0x50,0x94,0xad},{0xd5,0xaa,0x50,0x30,0xad} },
+    { {0xd5,0xaa,0x50,0x08,0xad},{0xd5,0xaa,0x50,0x28,0xad},{0xd5,0xaa,0x50,0x98,0xad},{0xd5,0xaa,0x50,0x88,0xad},{0xd5,0xaa,0x50,0x88,0xad},{0xd5,0xaa,0x50,0x99,0xad},{0xd5,0xaa,0x50,0x8c,0xad},{0xd5,0xaa,0x50,0x9c,0xad},{0xd5,0xaa,0x50,0x28,0xad} },
+    { {0xd5,0xaa,0x50,0x18,0xad},{0xd5,0xaa,0x50,0x38,0xad},{0xd5,0xaa,0x50,0x98,0xad},{0xd5,0xaa,0x50,0x98,0xad},{0xd5,0xaa,0x50,0x98,0xad},{0xd5,0xaa,0x50,0x99,0xad},{0xd5,0xaa,0x50,0x9c,0xad},{0xd5,0xaa,0x50,0x9c,0xad},{0xd5,0xaa,0x50,0x38,0xad} },
+    { {0xd5,0xaa,0x50,0x40,0xad},{0xd5,0xaa,0x50,0x60,0xad},{0xd5,0xaa,0x50,0xd8,0xad},{0xd5,0xaa,0x50,0xc8,0xad},{0xd5,0xaa,0x50,0xc0,0xad},{0xd5,0xaa,0x50,0xd1,0xad},{0xd5,0xaa,0x50,0xc4,0xad},{0xd5,0xaa,0x50,0xd4,0xad},{0xd5,0xaa,0x50,0x60,0xad} },
+    { {0xd5,0xaa,0x50,0x50,0xad},{0xd5,0xaa,0x50,0x70,0xad},{0xd5,0xaa,0x50,0xd8,0xad},{0xd5,0xaa,0x50,0xd8,0xad},{0xd5,0xaa,0x50,0xd0,0xad},{0xd5,0xaa,0x50,0xd1,0xad},{0xd5,0xaa,0x50,0xd4,0xad},{0xd5,0xaa,0x50,0xd4,0xad},{0xd5,0xaa,0x50,0x70,0xad} },
+    { {0xd5,0xaa,0x50,0x48,0xad},{0xd5,0xaa,0x50,0x68,0xad},{0xd5,0xaa,0x50,0xd8,0xad},{0xd5,0xaa,0x50,0xc8,0xad},{0xd5,0xaa,0x50,0xc8,0xad},{0xd5,0xaa,0x50,0xd9,0xad},{0xd5,0xaa,0x50,0xcc,0xad},{0xd5,0xaa,0x50,0xdc,0xad},{0xd5,0xaa,0x50,0x68,0xad} },
+    { {0xd5,0xaa,0x50,0x58,0xad},{0xd5,0xaa,0x50,0x78,0xad},{0xd5,0xaa,0x50,0xd8,0xad},{0xd5,0xaa,0x50,0xd8,0xad},{0xd5,0xaa,0x50,0xd8,0xad},{0xd5,0xaa,0x50,0xd9,0xad},{0xd5,0xaa,0x50,0xdc,0xad},{0xd5,0xaa,0x50,0xdc,0xad},{0xd5,0xaa,0x50,0x78,0xad} },
+    { {0xd5,0xaa,0x54,0x00,0xad},{0xd5,0xaa,0x54,0x20,0xad},{0xd5,0xaa,0x54,0x98,0xad},{0xd5,0xaa,0x54,0x88,0xad},{0xd5,0xaa,0x54,0x80,0xad},{0xd5,0xaa,0x54,0x91,0xad},{0xd5,0xaa,0x54,0x84,0xad},{0xd5,0xaa,0x54,0x94,0xad},{0xd5,0xaa,0x54,0x20,0xad} },
+    { {0xd5,0xaa,0x54,0x10,0xad},{0xd5,0xaa,0x54,0x30,0xad},{0xd5,0xaa,0x54,0x98,0xad},{0xd5,0xaa,0x54,0x98,0xad},{0xd5,0xaa,0x54,0x90,0xad},{0xd5,0xaa,0x54,0x91,0xad},{0xd5,0xaa,0x54,0x94,0xad},{0xd5,0xaa,0x54,0x94,0xad},{0xd5,0xaa,0x54,0x30,0xad} },
+    { {0xd5,0xaa,0x54,0x08,0xad},{0xd5,0xaa,0x54,0x28,0xad},{0xd5,0xaa,0x54,0x98,0xad},{0xd5,0xaa,0x54,0x88,0xad},{0xd5,0xaa,0x54,0x88,0xad},{0xd5,0xaa,0x54,0x99,0xad},{0xd5,0xaa,0x54,0x8c,0xad},{0xd5,0xaa,0x54,0x9c,0xad},{0xd5,0xaa,0x54,0x28,0xad} },
+    { {0xd5,0xaa,0x54,0x18,0xad},{0xd5,0xaa,0x54,0x38,0xad},{0xd5,0xaa,0x54,0x98,0xad},{0xd5,0xaa,0x54,0x98,0xad},{0xd5,0xaa,0x54,0x98,0xad},{0xd5,0xaa,0x54,0x99,0xad},{0xd5,0xaa,0x54,0x9c,0xad},{0xd5,0xaa,0x54,0x9c,0xad},{0xd5,0xaa,0x54,0x38,0xad} },
+    { {0xd5,0xaa,0x54,0x40,0xad},{0xd5,0xaa,0x54,0x60,0xad},{0xd5,0xaa,0x54,0xd8,0xad},{0xd5,0xaa,0x54,0xc8,0xad},{0xd5,0xaa,0x54,0xc0,0xad},{0xd5,0xaa,0x54,0xd1,0xad},{0xd5,0xaa,0x54,0xc4,0xad},{0xd5,0xaa,0x54,0xd4,0xad},{0xd5,0xaa,0x54,0x60,0xad} },
+    { {0xd5,0xaa,0x54,0x50,0xad},{0xd5,0xaa,0x54,0x70,0xad},{0xd5,0xaa,0x54,0xd8,0xad},{0xd5,0xaa,0x54,0xd8,0xad},{0xd5,0xaa,0x54,0xd0,0xad},{0xd5,0xaa,0x54,0xd1,0xad},{0xd5,0xaa,0x54,0xd4,0xad},{0xd5,0xaa,0x54,0xd4,0xad},{0xd5,0xaa,0x54,0x70,0xad} },
+    { {0xd5,0xaa,0x54,0x48,0xad},{0xd5,0xaa,0x54,0x68,0xad},{0xd5,0xaa,0x54,0xd8,0xad},{0xd5,0xaa,0x54,0xc8,0xad},{0xd5,0xaa,0x54,0xc8,0xad},{0xd5,0xaa,0x54,0xd9,0xad},{0xd5,0xaa,0x54,0xcc,0xad},{0xd5,0xaa,0x54,0xdc,0xad},{0xd5,0xaa,0x54,0x68,0xad} },
+    { {0xd5,0xaa,0x54,0x58,0xad},{0xd5,0xaa,0x54,0x78,0xad},{0xd5,0xaa,0x54,0xd8,0xad},{0xd5,0xaa,0x54,0xd8,0xad},{0xd5,0xaa,0x54,0xd8,0xad},{0xd5,0xaa,0x54,0xd9,0xad},{0xd5,0xaa,0x54,0xdc,0xad},{0xd5,0xaa,0x54,0xdc,0xad},{0xd5,0xaa,0x54,0x78,0xad} }
+  },
+  { /* E */
+    { {0xd5,0xaa,0x80,0x00,0xad},{0xd5,0xaa,0x80,0x20,0xad},{0xd5,0xaa,0x80,0x98,0xad},{0xd5,0xaa,0x80,0x88,0xad},{0xd5,0xaa,0x80,0x80,0xad},{0xd5,0xaa,0x80,0x91,0xad},{0xd5,0xaa,0x80,0x84,0xad},{0xd5,0xaa,0x80,0x94,0xad},{0xd5,0xaa,0x80,0x20,0xad} },
+    { {0xd5,0xaa,0x80,0x10,0xad},{0xd5,0xaa,0x80,0x30,0xad},{0xd5,0xaa,0x80,0x98,0xad},{0xd5,0xaa,0x80,0x98,0xad},{0xd5,0xaa,0x80,0x90,0xad},{0xd5,0xaa,0x80,0x91,0xad},{0xd5,0xaa,0x80,0x94,0xad},{0xd5,0xaa,0x80,0x94,0xad},{0xd5,0xaa,0x80,0x30,0xad} },
+    { {0xd5,0xaa,0x80,0x08,0xad},{0xd5,0xaa,0x80,0x28,0xad},{0xd5,0xaa,0x80,0x98,0xad},{0xd5,0xaa,0x80,0x88,0xad},{0xd5,0xaa,0x80,0x88,0xad},{0xd5,0xaa,0x80,0x99,0xad},{0xd5,0xaa,0x80,0x8c,0xad},{0xd5,0xaa,0x80,0x9c,0xad},{0xd5,0xaa,0x80,0x28,0xad} },
+    { {0xd5,0xaa,0x80,0x18,0xad},{0xd5,0xaa,0x80,0x38,0xad},{0xd5,0xaa,0x80,0x98,0xad},{0xd5,0xaa,0x80,0x98,0xad},{0xd5,0xaa,0x80,0x98,0xad},{0xd5,0xaa,0x80,0x99,0xad},{0xd5,0xaa,0x80,0x9c,0xad},{0xd5,0xaa,0x80,0x9c,0xad},{0xd5,0xaa,0x80,0x38,0xad} },
+    { {0xd5,0xaa,0x80,0x40,0xad},{0xd5,0xaa,0x80,0x60,0xad},{0xd5,0xaa,0x80,0xd8,0xad},{0xd5,0xaa,0x80,0xc8,0xad},{0xd5,0xaa,0x80,0xc0,0xad},{0xd5,0xaa,0x80,0xd1,0xad},{0xd5,0xaa,0x80,0xc4,0xad},{0xd5,0xaa,0x80,0xd4,0xad},{0xd5,0xaa,0x80,0x60,0xad} },
+    { {0xd5,0xaa,0x80,0x50,0xad},{0xd5,0xaa,0x80,0x70,0xad},{0xd5,0xaa,0x80,0xd8,0xad},{0xd5,0xaa,0x80,0xd8,0xad},{0xd5,0xaa,0x80,0xd0,0xad},{0xd5,0xaa,0x80,0xd1,0xad},{0xd5,0xaa,0x80,0xd4,0xad},{0xd5,0xaa,0x80,0xd4,0xad},{0xd5,0xaa,0x80,0x70,0xad} },
+    { {0xd5,0xaa,0x80,0x48,0xad},{0xd5,0xaa,0x80,0x68,0xad},{0xd5,0xaa,0x80,0xd8,0xad},{0xd5,0xaa,0x80,0xc8,0xad},{0xd5,0xaa,0x80,0xc8,0xad},{0xd5,0xaa,0x80,0xd9,0xad},{0xd5,0xaa,0x80,0xcc,0xad},{0xd5,0xaa,0x80,0xdc,0xad},{0xd5,0xaa,0x80,0x68,0xad} },
+    { {0xd5,0xaa,0x80,0x58,0xad},{0xd5,0xaa,0x80,0x78,0xad},{0xd5,0xaa,0x80,0xd8,0xad},{0xd5,0xaa,0x80,0xd8,0xad},{0xd5,0xaa,0x80,0xd8,0xad},{0xd5,0xaa,0x80,0xd9,0xad},{0xd5,0xaa,0x80,0xdc,0xad},{0xd5,0xaa,0x80,0xdc,0xad},{0xd5,0xaa,0x80,0x78,0xad} },
+    { {0xd5,0xaa,0x84,0x00,0xad},{0xd5,0xaa,0x84,0x20,0xad},{0xd5,0xaa,0x84,0x98,0xad},{0xd5,0xaa,0x84,0x88,0xad},{0xd5,0xaa,0x84,0x80,0xad},{0xd5,0xaa,0x84,0x91,0xad},{0xd5,0xaa,0x84,0x84,0xad},{0xd5,0xaa,0x84,0x94,0xad},{0xd5,0xaa,0x84,0x20,0xad} },
+    { {0xd5,0xaa,0x84,0x10,0xad},{0xd5,0xaa,0x84,0x30,0xad},{0xd5,0xaa,0x84,0x98,0xad},{0xd5,0xaa,0x84,0x98,0xad},{0xd5,0xaa,0x84,0x90,0xad},{0xd5,0xaa,0x84,0x91,0xad},{0xd5,0xaa,0x84,0x94,0xad},{0xd5,0xaa,0x84,0x94,0xad},{0xd5,0xaa,0x84,0x30,0xad} },
+    { {0xd5,0xaa,0x84,0x08,0xad},{0xd5,0xaa,0x84,0x28,0xad},{0xd5,0xaa,0x84,0x98,0xad},{0xd5,0xaa,0x84,0x88,0xad},{0xd5,0xaa,0x84,0x88,0xad},{0xd5,0xaa,0x84,0x99,0xad},{0xd5,0xaa,0x84,0x8c,0xad},{0xd5,0xaa,0x84,0x9c,0xad},{0xd5,0xaa,0x84,0x28,0xad} },
+    { {0xd5,0xaa,0x84,0x18,0xad},{0xd5,0xaa,0x84,0x38,0xad},{0xd5,0xaa,0x84,0x98,0xad},{0xd5,0xaa,0x84,0x98,0xad},{0xd5,0xaa,0x84,0x98,0xad},{0xd5,0xaa,0x84,0x99,0xad},{0xd5,0xaa,0x84,0x9c,0xad},{0xd5,0xaa,0x84,0x9c,0xad},{0xd5,0xaa,0x84,0x38,0xad} },
+    { {0xd5,0xaa,0x84,0x40,0xad},{0xd5,0xaa,0x84,0x60,0xad},{0xd5,0xaa,0x84,0xd8,0xad},{0xd5,0xaa,0x84,0xc8,0xad},{0xd5,0xaa,0x84,0xc0,0xad},{0xd5,0xaa,0x84,0xd1,0xad},{0xd5,0xaa,0x84,0xc4,0xad},{0xd5,0xaa,0x84,0xd4,0xad},{0xd5,0xaa,0x84,0x60,0xad} },
+    { {0xd5,0xaa,0x84,0x50,0xad},{0xd5,0xaa,0x84,0x70,0xad},{0xd5,0xaa,0x84,0xd8,0xad},{0xd5,0xaa,0x84,0xd8,0xad},{0xd5,0xaa,0x84,0xd0,0xad},{0xd5,0xaa,0x84,0xd1,0xad},{0xd5,0xaa,0x84,0xd4,0xad},{0xd5,0xaa,0x84,0xd4,0xad},{0xd5,0xaa,0x84,0x70,0xad} },
+    { {0xd5,0xaa,0x84,0x48,0xad},{0xd5,0xaa,0x84,0x68,0xad},{0xd5,0xaa,0x84,0xd8,0xad},{0xd5,0xaa,0x84,0xc8,0xad},{0xd5,0xaa,0x84,0xc8,0xad},{0xd5,0xaa,0x84,0xd9,0xad},{0xd5,0xaa,0x84,0xcc,0xad},{0xd5,0xaa,0x84,0xdc,0xad},{0xd5,0xaa,0x84,0x68,0xad} },
+    { {0xd5,0xaa,0x84,0x58,0xad},{0xd5,0xaa,0x84,0x78,0xad},{0xd5,0xaa,0x84,0xd8,0xad},{0xd5,0xaa,0x84,0xd8,0xad},{0xd5,0xaa,0x84,0xd8,0xad},{0xd5,0xaa,0x84,0xd9,0xad},{0xd5,0xaa,0x84,0xdc,0xad},{0xd5,0xaa,0x84,0xdc,0xad},{0xd5,0xaa,0x84,0x78,0xad} }
+  },
+  { /* F */
+    { {0xd5,0xaa,0x90,0x00,0xad},{0xd5,0xaa,0x90,0x20,0xad},{0xd5,0xaa,0x90,0x98,0xad},{0xd5,0xaa,0x90,0x88,0xad},{0xd5,0xaa,0x90,0x80,0xad},{0xd5,0xaa,0x90,0x91,0xad},{0xd5,0xaa,0x90,0x84,0xad},{0xd5,0xaa,0x90,0x94,0xad},{0xd5,0xaa,0x90,0x20,0xad} },
+    { {0xd5,0xaa,0x90,0x10,0xad},{0xd5,0xaa,0x90,0x30,0xad},{0xd5,0xaa,0x90,0x98,0xad},{0xd5,0xaa,0x90,0x98,0xad},{0xd5,0xaa,0x90,0x90,0xad},{0xd5,0xaa,0x90,0x91,0xad},{0xd5,0xaa,0x90,0x94,0xad},{0xd5,0xaa,0x90,0x94,0xad},{0xd5,0xaa,0x90,0x30,0xad} },
+    { {0xd5,0xaa,0x90,0x08,0xad},{0xd5,0xaa,0x90,0x28,0xad},{0xd5,0xaa,0x90,0x98,0xad},{0xd5,0xaa,0x90,0x88,0xad},{0xd5,0xaa,0x90,0x88,0xad},{0xd5,0xaa,0x90,0x99,0xad},{0xd5,0xaa,0x90,0x8c,0xad},{0xd5,0xaa,0x90,0x9c,0xad},{0xd5,0xaa,0x90,0x28,0xad} },
+    { {0xd5,0xaa,0x90,0x18,0xad},{0xd5,0xaa,0x90,0x38,0xad},{0xd5,0xaa,0x90,0x98,0xad},{0xd5,0xaa,0x90,0x98,0xad},{0xd5,0xaa,0x90,0x98,0xad},{0xd5,0xaa,0x90,0x99,0xad},{0xd5,0xaa,0x90,0x9c,0xad},{0xd5,0xaa,0x90,0x9c,0xad},{0xd5,0xaa,0x90,0x38,0xad} },
+    { {0xd5,0xaa,0x90,0x40,0xad},{0xd5,0xaa,0x90,0x60,0xad},{0xd5,0xaa,0x90,0xd8,0xad},{0xd5,0xaa,0x90,0xc8,0xad},{0xd5,0xaa,0x90,0xc0,0xad},{0xd5,0xaa,0x90,0xd1,0xad},{0xd5,0xaa,0x90,0xc4,0xad},{0xd5,0xaa,0x90,0xd4,0xad},{0xd5,0xaa,0x90,0x60,0xad} },
+    { {0xd5,0xaa,0x90,0x50,0xad},{0xd5,0xaa,0x90,0x70,0xad},{0xd5,0xaa,0x90,0xd8,0xad},{0xd5,0xaa,0x90,0xd8,0xad},{0xd5,0xaa,0x90,0xd0,0xad},{0xd5,0xaa,0x90,0xd1,0xad},{0xd5,0xaa,0x90,0xd4,0xad},{0xd5,0xaa,0x90,0xd4,0xad},{0xd5,0xaa,0x90,0x70,0xad} },
+    { {0xd5,0xaa,0x90,0x48,0xad},{0xd5,0xaa,0x90,0x68,0xad},{0xd5,0xaa,0x90,0xd8,0xad},{0xd5,0xaa,0x90,0xc8,0xad},{0xd5,0xaa,0x90,0xc8,0xad},{0xd5,0xaa,0x90,0xd9,0xad},{0xd5,0xaa,0x90,0xcc,0xad},{0xd5,0xaa,0x90,0xdc,0xad},{0xd5,0xaa,0x90,0x68,0xad} },
+    { {0xd5,0xaa,0x90,0x58,0xad},{0xd5,0xaa,0x90,0x78,0xad},{0xd5,0xaa,0x90,0xd8,0xad},{0xd5,0xaa,0x90,0xd8,0xad},{0xd5,0xaa,0x90,0xd8,0xad},{0xd5,0xaa,0x90,0xd9,0xad},{0xd5,0xaa,0x90,0xdc,0xad},{0xd5,0xaa,0x90,0xdc,0xad},{0xd5,0xaa,0x90,0x78,0xad} },
+    { {0xd5,0xaa,0x94,0x00,0xad},{0xd5,0xaa,0x94,0x20,0xad},{0xd5,0xaa,0x94,0x98,0xad},{0xd5,0xaa,0x94,0x88,0xad},{0xd5,0xaa,0x94,0x80,0xad},{0xd5,0xaa,0x94,0x91,0xad},{0xd5,0xaa,0x94,0x84,0xad},{0xd5,0xaa,0x94,0x94,0xad},{0xd5,0xaa,0x94,0x20,0xad} },
+    { {0xd5,0xaa,0x94,0x10,0xad},{0xd5,0xaa,0x94,0x30,0xad},{0xd5,0xaa,0x94,0x98,0xad},{0xd5,0xaa,0x94,0x98,0xad},{0xd5,0xaa,0x94,0x90,0xad},{0xd5,0xaa,0x94,0x91,0xad},{0xd5,0xaa,0x94,0x94,0xad},{0xd5,0xaa,0x94,0x94,0xad},{0xd5,0xaa,0x94,0x30,0xad} },
+    { {0xd5,0xaa,0x94,0x08,0xad},{0xd5,0xaa,0x94,0x28,0xad},{0xd5,0xaa,0x94,0x98,0xad},{0xd5,0xaa,0x94,0x88,0xad},{0xd5,0xaa,0x94,0x88,0xad},{0xd5,0xaa,0x94,0x99,0xad},{0xd5,0xaa,0x94,0x8c,0xad},{0xd5,0xaa,0x94,0x9c,0xad},{0xd5,0xaa,0x94,0x28,0xad} },
+    { {0xd5,0xaa,0x94,0x18,0xad},{0xd5,0xaa,0x94,0x38,0xad},{0xd5,0xaa,0x94,0x98,0xad},{0xd5,0xaa,0x94,0x98,0xad},{0xd5,0xaa,0x94,0x98,0xad},{0xd5,0xaa,0x94,0x99,0xad},{0xd5,0xaa,0x94,0x9c,0xad},{0xd5,0xaa,0x94,0x9c,0xad},{0xd5,0xaa,0x94,0x38,0xad} },
+    { {0xd5,0xaa,0x94,0x40,0xad},{0xd5,0xaa,0x94,0x60,0xad},{0xd5,0xaa,0x94,0xd8,0xad},{0xd5,0xaa,0x94,0xc8,0xad},{0xd5,0xaa,0x94,0xc0,0xad},{0xd5,0xaa,0x94,0xd1,0xad},{0xd5,0xaa,0x94,0xc4,0xad},{0xd5,0xaa,0x94,0xd4,0xad},{0xd5,0xaa,0x94,0x60,0xad} },
+    { {0xd5,0xaa,0x94,0x50,0xad},{0xd5,0xaa,0x94,0x70,0xad},{0xd5,0xaa,0x94,0xd8,0xad},{0xd5,0xaa,0x94,0xd8,0xad},{0xd5,0xaa,0x94,0xd0,0xad},{0xd5,0xaa,0x94,0xd1,0xad},{0xd5,0xaa,0x94,0xd4,0xad},{0xd5,0xaa,0x94,0xd4,0xad},{0xd5,0xaa,0x94,0x70,0xad} },
+    { {0xd5,0xaa,0x94,0x48,0xad},{0xd5,0xaa,0x94,0x68,0xad},{0xd5,0xaa,0x94,0xd8,0xad},{0xd5,0xaa,0x94,0xc8,0xad},{0xd5,0xaa,0x94,0xc8,0xad},{0xd5,0xaa,0x94,0xd9,0xad},{0xd5,0xaa,0x94,0xcc,0xad},{0xd5,0xaa,0x94,0xdc,0xad},{0xd5,0xaa,0x94,0x68,0xad} },
+    { {0xd5,0xaa,0x94,0x58,0xad},{0xd5,0xaa,0x94,0x78,0xad},{0xd5,0xaa,0x94,0xd8,0xad},{0xd5,0xaa,0x94,0xd8,0xad},{0xd5,0xaa,0x94,0xd8,0xad},{0xd5,0xaa,0x94,0xd9,0xad},{0xd5,0xaa,0x94,0xdc,0xad},{0xd5,0xaa,0x94,0xdc,0xad},{0xd5,0xaa,0x94,0x78,0xad} }
+  },
+  { /* G */
+    { {0xd5,0xaa,0xa0,0x00,0xad},{0xd5,0xaa,0xa0,0x20,0xad},{0xd5,0xaa,0xa0,0x98,0xad},{0xd5,0xaa,0xa0,0x88,0xad},{0xd5,0xaa,0xa0,0x80,0xad},{0xd5,0xaa,0xa0,0x91,0xad},{0xd5,0xaa,0xa0,0x84,0xad},{0xd5,0xaa,0xa0,0x94,0xad},{0xd5,0xaa,0xa0,0x20,0xad} },
+    { {0xd5,0xaa,0xa0,0x10,0xad},{0xd5,0xaa,0xa0,0x30,0xad},{0xd5,0xaa,0xa0,0x98,0xad},{0xd5,0xaa,0xa0,0x98,0xad},{0xd5,0xaa,0xa0,0x90,0xad},{0xd5,0xaa,0xa0,0x91,0xad},{0xd5,0xaa,0xa0,0x94,0xad},{0xd5,0xaa,0xa0,0x94,0xad},{0xd5,0xaa,0xa0,0x30,0xad} },
+    { {0xd5,0xaa,0xa0,0x08,0xad},{0xd5,0xaa,0xa0,0x28,0xad},{0xd5,0xaa,0xa0,0x98,0xad},{0xd5,0xaa,0xa0,0x88,0xad},{0xd5,0xaa,0xa0,0x88,0xad},{0xd5,0xaa,0xa0,0x99,0xad},{0xd5,0xaa,0xa0,0x8c,0xad},{0xd5,0xaa,0xa0,0x9c,0xad},{0xd5,0xaa,0xa0,0x28,0xad} },
+    { {0xd5,0xaa,0xa0,0x18,0xad},{0xd5,0xaa,0xa0,0x38,0xad},{0xd5,0xaa,0xa0,0x98,0xad},{0xd5,0xaa,0xa0,0x98,0xad},{0xd5,0xaa,0xa0,0x98,0xad},{0xd5,0xaa,0xa0,0x99,0xad},{0xd5,0xaa,0xa0,0x9c,0xad},{0xd5,0xaa,0xa0,0x9c,0xad},{0xd5,0xaa,0xa0,0x38,0xad} },
+    { {0xd5,0xaa,0xa0,0x40,0xad},{0xd5,0xaa,0xa0,0x60,0xad},{0xd5,0xaa,0xa0,0xd8,0xad},{0xd5,0xaa,0xa0,0xc8,0xad},{0xd5,0xaa,0xa0,0xc0,0xad},{0xd5,0xaa,0xa0,0xd1,0xad},{0xd5,0xaa,0xa0,0xc4,0xad},{0xd5,0xaa,0xa0,0xd4,0xad},{0xd5,0xaa,0xa0,0x60,0xad} },
+    { {0xd5,0xaa,0xa0,0x50,0xad},{0xd5,0xaa,0xa0,0x70,0xad},{0xd5,0xaa,0xa0,0xd8,0xad},{0xd5,0xaa,0xa0,0xd8,0xad},{0xd5,0xaa,0xa0,0xd0,0xad},{0xd5,0xaa,0xa0,0xd1,0xad},{0xd5,0xaa,0xa0,0xd4,0xad},{0xd5,0xaa,0xa0,0xd4,0xad},{0xd5,0xaa,0xa0,0x70,0xad} },
+    { {0xd5,0xaa,0xa0,0x48,0xad},{0xd5,0xaa,0xa0,0x68,0xad},{0xd5,0xaa,0xa0,0xd8,0xad},{0xd5,0xaa,0xa0,0xc8,0xad},{0xd5,0xaa,0xa0,0xc8,0xad},{0xd5,0xaa,0xa0,0xd9,0xad},{0xd5,0xaa,0xa0,0xcc,0xad},{0xd5,0xaa,0xa0,0xdc,0xad},{0xd5,0xaa,0xa0,0x68,0xad} },
+    { {0xd5,0xaa,0xa0,0x58,0xad},{0xd5,0xaa,0xa0,0x78,0xad},{0xd5,0xaa,0xa0,0xd8,0xad},{0xd5,0xaa,0xa0,0xd8,0xad},{0xd5,0xaa,0xa0,0xd8,0xad},{0xd5,0xaa,0xa0,0xd9,0xad},{0xd5,0xaa,0xa0,0xdc,0xad},{0xd5,0xaa,0xa0,0xdc,0xad},{0xd5,0xaa,0xa0,0x78,0xad} },
+    { {0xd5,0xaa,0xa4,0x00,0xad},{0xd5,0xaa,0xa4,0x20,0xad},{0xd5,0xaa,0xa4,0x98,0xad},{0xd5,0xaa,0xa4,0x88,0xad},{0xd5,0xaa,0xa4,0x80,0xad},{0xd5,0xaa,0xa4,0x91,0xad},{0xd5,0xaa,0xa4,0x84,0xad},{0xd5,0xaa,0xa4,0x94,0xad},{0xd5,0xaa,0xa4,0x20,0xad} },
+    { {0xd5,0xaa,0xa4,0x10,0xad},{0xd5,0xaa,0xa4,0x30,0xad},{0xd5,0xaa,0xa4,0x98,0xad},{0xd5,0xaa,0xa4,0x98,0xad},{0xd5,0xaa,0xa4,0x90,0xad},{0xd5,0xaa,0xa4,0x91,0xad},{0xd5,0xaa,0xa4,0x94,0xad},{0xd5,0xaa,0xa4,0x94,0xad},{0xd5,0xaa,0xa4,0x30,0xad} },
+    { {0xd5,0xaa,0xa4,0x08,0xad},{0xd5,0xaa,0xa4,0x28,0xad},{0xd5,0xaa,0xa4,0x98,0xad},{0xd5,0xaa,0xa4,0x88,0xad},{0xd5,0xaa,0xa4,0x88,0xad},{0xd5,0xaa,0xa4,0x99,0xad},{0xd5,0xaa,0xa4,0x8c,0xad},{0xd5,0xaa,0xa4,0x9c,0xad},{0xd5,0xaa,0xa4,0x28,0xad} },
+    { {0xd5,0xaa,0xa4,0x18,0xad},{0xd5,0xaa,0xa4,0x38,0xad},{0xd5,0xaa,0xa4,0x98,0xad},{0xd5,0xaa,0xa4,0x98,0xad},{0xd5,0xaa,0xa4,0x98,0xad},{0xd5,0xaa,0xa4,0x99,0xad},{0xd5,0xaa,0xa4,0x9c,0xad},{0xd5,0xaa,0xa4,0x9c,0xad},{0xd5,0xaa,0xa4,0x38,0xad} },
+    { {0xd5,0xaa,0xa4,0x40,0xad},{0xd5,0xaa,0xa4,0x60,0xad},{0xd5,0xaa,0xa4,0xd8,0xad},{0xd5,0xaa,0xa4,0xc8,0xad},{0xd5,0xaa,0xa4,0xc0,0xad},{0xd5,0xaa,0xa4,0xd1,0xad},{0xd5,0xaa,0xa4,0xc4,0xad},{0xd5,0xaa,0xa4,0xd4,0xad},{0xd5,0xaa,0xa4,0x60,0xad} },
+    { {0xd5,0xaa,0xa4,0x50,0xad},{0xd5,0xaa,0xa4,0x70,0xad},{0xd5,0xaa,0xa4,0xd8,0xad},{0xd5,0xaa,0xa4,0xd8,0xad},{0xd5,0xaa,0xa4,0xd0,0xad},{0xd5,0xaa,0xa4,0xd1,0xad},{0xd5,0xaa,0xa4,0xd4,0xad},{0xd5,0xaa,0xa4,0xd4,0xad},{0xd5,0xaa,0xa4,0x70,0xad} },
+    { {0xd5,0xaa,0xa4,0x48,0xad},{0xd5,0xaa,0xa4,0x68,0xad},{0xd5,0xaa,0xa4,0xd8,0xad},{0xd5,0xaa,0xa4,0xc8,0xad},{0xd5,0xaa,0xa4,0xc8,0xad},{0xd5,0xaa,0xa4,0xd9,0xad},{0xd5,0xaa,0xa4,0xcc,0xad},{0xd5,0xaa,0xa4,0xdc,0xad},{0xd5,0xaa,0xa4,0x68,0xad} },
+    { {0xd5,0xaa,0xa4,0x58,0xad},{0xd5,0xaa,0xa4,0x78,0xad},{0xd5,0xaa,0xa4,0xd8,0xad},{0xd5,0xaa,0xa4,0xd8,0xad},{0xd5,0xaa,0xa4,0xd8,0xad},{0xd5,0xaa,0xa4,0xd9,0xad},{0xd5,0xaa,0xa4,0xdc,0xad},{0xd5,0xaa,0xa4,0xdc,0xad},{0xd5,0xaa,0xa4,0x78,0xad} }
+  },
+  { /* H */
+    { {0xd5,0xaa,0xb0,0x00,0xad},{0xd5,0xaa,0xb0,0x20,0xad},{0xd5,0xaa,0xb0,0x98,0xad},{0xd5,0xaa,0xb0,0x88,0xad},{0xd5,0xaa,0xb0,0x80,0xad},{0xd5,0xaa,0xb0,0x91,0xad},{0xd5,0xaa,0xb0,0x84,0xad},{0xd5,0xaa,0xb0,0x94,0xad},{0xd5,0xaa,0xb0,0x20,0xad} },
+    { {0xd5,0xaa,0xb0,0x10,0xad},{0xd5,0xaa,0xb0,0x30,0xad},{0xd5,0xaa,0xb0,0x98,0xad},{0xd5,0xaa,0xb0,0x98,0xad},{0xd5,0xaa,0xb0,0x90,0xad},{0xd5,0xaa,0xb0,0x91,0xad},{0xd5,0xaa,0xb0,0x94,0xad},{0xd5,0xaa,0xb0,0x94,0xad},{0xd5,0xaa,0xb0,0x30,0xad} },
+    { {0xd5,0xaa,0xb0,0x08,0xad},{0xd5,0xaa,0xb0,0x28,0xad},{0xd5,0xaa,0xb0,0x98,0xad},{0xd5,0xaa,0xb0,0x88,0xad},{0xd5,0xaa,0xb0,0x88,0xad},{0xd5,0xaa,0xb0,0x99,0xad},{0xd5,0xaa,0xb0,0x8c,0xad},{0xd5,0xaa,0xb0,0x9c,0xad},{0xd5,0xaa,0xb0,0x28,0xad} },
+    { {0xd5,0xaa,0xb0,0x18,0xad},{0xd5,0xaa,0xb0,0x38,0xad},{0xd5,0xaa,0xb0,0x98,0xad},{0xd5,0xaa,0xb0,0x98,0xad},{0xd5,0xaa,0xb0,0x98,0xad},{0xd5,0xaa,0xb0,0x99,0xad},{0xd5,0xaa,0xb0,0x9c,0xad},{0xd5,0xaa,0xb0,0x9c,0xad},{0xd5,0xaa,0xb0,0x38,0xad} },
+    { {0xd5,0xaa,0xb0,0x40,0xad},{0xd5,0xaa,0xb0,0x60,0xad},{0xd5,0xaa,0xb0,0xd8,0xad},{0xd5,0xaa,0xb0,0xc8,0xad},{0xd5,0xaa,0xb0,0xc0,0xad},{0xd5,0xaa,0xb0,0xd1,0xad},{0xd5,0xaa,0xb0,0xc4,0xad},{0xd5,0xaa,0xb0,0xd4,0xad},{0xd5,0xaa,0xb0,0x60,0xad} },
+    { {0xd5,0xaa,0xb0,0x50,0xad},{0xd5,0xaa,0xb0,0x70,0xad},{0xd5,0xaa,0xb0,0xd8,0xad},{0xd5,0xaa,0xb0,0xd8,0xad},{0xd5,0xaa,0xb0,0xd0,0xad},{0xd5,0xaa,0xb0,0xd1,0xad},{0xd5,0xaa,0xb0,0xd4,0xad},{0xd5,0xaa,0xb0,0xd4,0xad},{0xd5,0xaa,0xb0,0x70,0xad} },
+    { {0xd5,0xaa,0xb0,0x48,0xad},{0xd5,0xaa,0xb0,0x68,0xad},{0xd5,0xaa,0xb0,0xd8,0xad},{0xd5,0xaa,0xb0,0xc8,0xad},{0xd5,0xaa,0xb0,0xc8,0xad},{0xd5,0xaa,0xb0,0xd9,0xad},{0xd5,0xaa,0xb0,0xcc,0xad},{0xd5,0xaa,0xb0,0xdc,0xad},{0xd5,0xaa,0xb0,0x68,0xad} },
+    { {0xd5,0xaa,0xb0,0x58,0xad},{0xd5,0xaa,0xb0,0x78,0xad},{0xd5,0xaa,0xb0,0xd8,0xad},{0xd5,0xaa,0xb0,0xd8,0xad},{0xd5,0xaa,0xb0,0xd8,0xad},{0xd5,0xaa,0xb0,0xd9,0xad},{0xd5,0xaa,0xb0,0xdc,0xad},{0xd5,0xaa,0xb0,0xdc,0xad},{0xd5,0xaa,0xb0,0x78,0xad} },
+    { {0xd5,0xaa,0xb4,0x00,0xad},{0xd5,0xaa,0xb4,0x20,0xad},{0xd5,0xaa,0xb4,0x98,0xad},{0xd5,0xaa,0xb4,0x88,0xad},{0xd5,0xaa,0xb4,0x80,0xad},{0xd5,0xaa,0xb4,0x91,0xad},{0xd5,0xaa,0xb4,0x84,0xad},{0xd5,0xaa,0xb4,0x94,0xad},{0xd5,0xaa,0xb4,0x20,0xad} },
+    { {0xd5,0xaa,0xb4,0x10,0xad},{0xd5,0xaa,0xb4,0x30,0xad},{0xd5,0xaa,0xb4,0x98,0xad},{0xd5,0xaa,0xb4,0x98,0xad},{0xd5,0xaa,0xb4,0x90,0xad},{0xd5,0xaa,0xb4,0x91,0xad},{0xd5,0xaa,0xb4,0x94,0xad},{0xd5,0xaa,0xb4,0x94,0xad},{0xd5,0xaa,0xb4,0x30,0xad} },
+    { {0xd5,0xaa,0xb4,0x08,0xad},{0xd5,0xaa,0xb4,0x28,0xad},{0xd5,0xaa,0xb4,0x98,0xad},{0xd5,0xaa,0xb4,0x88,0xad},{0xd5,0xaa,0xb4,0x88,0xad},{0xd5,0xaa,0xb4,0x99,0xad},{0xd5,0xaa,0xb4,0x8c,0xad},{0xd5,0xaa,0xb4,0x9c,0xad},{0xd5,0xaa,0xb4,0x28,0xad} },
+    { {0xd5,0xaa,0xb4,0x18,0xad},{0xd5,0xaa,0xb4,0x38,0xad},{0xd5,0xaa,0xb4,0x98,0xad},{0xd5,0xaa,0xb4,0x98,0xad},{0xd5,0xaa,0xb4,0x98,0xad},{0xd5,0xaa,0xb4,0x99,0xad},{0xd5,0xaa,0xb4,0x9c,0xad},{0xd5,0xaa,0xb4,0x9c,0xad},{0xd5,0xaa,0xb4,0x38,0xad} },
+    { {0xd5,0xaa,0xb4,0x40,0xad},{0xd5,0xaa,0xb4,0x60,0xad},{0xd5,0xaa,0xb4,0xd8,0xad},{0xd5,0xaa,0xb4,0xc8,0xad},{0xd5,0xaa,0xb4,0xc0,0xad},{0xd5,0xaa,0xb4,0xd1,0xad},{0xd5,0xaa,0xb4,0xc4,0xad},{0xd5,0xaa,0xb4,0xd4,0xad},{0xd5,0xaa,0xb4,0x60,0xad} },
+    { {0xd5,0xaa,0xb4,0x50,0xad},{0xd5,0xaa,0xb4,0x70,0xad},{0xd5,0xaa,0xb4,0xd8,0xad},{0xd5,0xaa,0xb4,0xd8,0xad},{0xd5,0xaa,0xb4,0xd0,0xad},{0xd5,0xaa,0xb4,0xd1,0xad},{0xd5,0xaa,0xb4,0xd4,0xad},{0xd5,0xaa,0xb4,0xd4,0xad},{0xd5,0xaa,0xb4,0x70,0xad} },
+    { {0xd5,0xaa,0xb4,0x48,0xad},{0xd5,0xaa,0xb4,0x68,0xad},{0xd5,0xaa,0xb4,0xd8,0xad},{0xd5,0xaa,0xb4,0xc8,0xad},{0xd5,0xaa,0xb4,0xc8,0xad},{0xd5,0xaa,0xb4,0xd9,0xad},{0xd5,0xaa,0xb4,0xcc,0xad},{0xd5,0xaa,0xb4,0xdc,0xad},{0xd5,0xaa,0xb4,0x68,0xad} },
+    { {0xd5,0xaa,0xb4,0x58,0xad},{0xd5,0xaa,0xb4,0x78,0xad},{0xd5,0xaa,0xb4,0xd8,0xad},{0xd5,0xaa,0xb4,0xd8,0xad},{0xd5,0xaa,0xb4,0xd8,0xad},{0xd5,0xaa,0xb4,0xd9,0xad},{0xd5,0xaa,0xb4,0xdc,0xad},{0xd5,0xaa,0xb4,0xdc,0xad},{0xd5,0xaa,0xb4,0x78,0xad} }
+  },
+  { /* I */
+    { {0xd5,0xaa,0xe0,0x00,0xad},{0xd5,0xaa,0xe0,0x20,0xad},{0xd5,0xaa,0xe0,0x98,0xad},{0xd5,0xaa,0xe0,0x88,0xad},{0xd5,0xaa,0xe0,0x80,0xad},{0xd5,0xaa,0xe0,0x91,0xad},{0xd5,0xaa,0xe0,0x84,0xad},{0xd5,0xaa,0xe0,0x94,0xad},{0xd5,0xaa,0xe0,0x20,0xad} },
+    { {0xd5,0xaa,0xe0,0x10,0xad},{0xd5,0xaa,0xe0,0x30,0xad},{0xd5,0xaa,0xe0,0x98,0xad},{0xd5,0xaa,0xe0,0x98,0xad},{0xd5,0xaa,0xe0,0x90,0xad},{0xd5,0xaa,0xe0,0x91,0xad},{0xd5,0xaa,0xe0,0x94,0xad},{0xd5,0xaa,0xe0,0x94,0xad},{0xd5,0xaa,0xe0,0x30,0xad} },
+    { {0xd5,0xaa,0xe0,0x08,0xad},{0xd5,0xaa,0xe0,0x28,0xad},{0xd5,0xaa,0xe0,0x98,0xad},{0xd5,0xaa,0xe0,0x88,0xad},{0xd5,0xaa,0xe0,0x88,0xad},{0xd5,0xaa,0xe0,0x99,0xad},{0xd5,0xaa,0xe0,0x8c,0xad},{0xd5,0xaa,0xe0,0x9c,0xad},{0xd5,0xaa,0xe0,0x28,0xad} },
+    { {0xd5,0xaa,0xe0,0x18,0xad},{0xd5,0xaa,0xe0,0x38,0xad},{0xd5,0xaa,0xe0,0x98,0xad},{0xd5,0xaa,0xe0,0x98,0xad},{0xd5,0xaa,0xe0,0x98,0xad},{0xd5,0xaa,0xe0,0x99,0xad},{0xd5,0xaa,0xe0,0x9c,0xad},{0xd5,0xaa,0xe0,0x9c,0xad},{0xd5,0xaa,0xe0,0x38,0xad} },
+    { {0xd5,0xaa,0xe0,0x40,0xad},{0xd5,0xaa,0xe0,0x60,0xad},{0xd5,0xaa,0xe0,0xd8,0xad},{0xd5,0xaa,0xe0,0xc8,0xad},{0xd5,0xaa,0xe0,0xc0,0xad},{0xd5,0xaa,0xe0,0xd1,0xad},{0xd5,0xaa,0xe0,0xc4,0xad},{0xd5,0xaa,0xe0,0xd4,0xad},{0xd5,0xaa,0xe0,0x60,0xad} },
+    { {0xd5,0xaa,0xe0,0x50,0xad},{0xd5,0xaa,0xe0,0x70,0xad},{0xd5,0xaa,0xe0,0xd8,0xad},{0xd5,0xaa,0xe0,0xd8,0xad},{0xd5,0xaa,0xe0,0xd0,0xad},{0xd5,0xaa,0xe0,0xd1,0xad},{0xd5,0xaa,0xe0,0xd4,0xad},{0xd5,0xaa,0xe0,0xd4,0xad},{0xd5,0xaa,0xe0,0x70,0xad} },
+    { {0xd5,0xaa,0xe0,0x48,0xad},{0xd5,0xaa,0xe0,0x68,0xad},{0xd5,0xaa,0xe0,0xd8,0xad},{0xd5,0xaa,0xe0,0xc8,0xad},{0xd5,0xaa,0xe0,0xc8,0xad},{0xd5,0xaa,0xe0,0xd9,0xad},{0xd5,0xaa,0xe0,0xcc,0xad},{0xd5,0xaa,0xe0,0xdc,0xad},{0xd5,0xaa,0xe0,0x68,0xad} },
+    { {0xd5,0xaa,0xe0,0x58,0xad},{0xd5,0xaa,0xe0,0x78,0xad},{0xd5,0xaa,0xe0,0xd8,0xad},{0xd5,0xaa,0xe0,0xd8,0xad},{0xd5,0xaa,0xe0,0xd8,0xad},{0xd5,0xaa,0xe0,0xd9,0xad},{0xd5,0xaa,0xe0,0xdc,0xad},{0xd5,0xaa,0xe0,0xdc,0xad},{0xd5,0xaa,0xe0,0x78,0xad} },
+    { {0xd5,0xaa,0xe4,0x00,0xad},{0xd5,0xaa,0xe4,0x20,0xad},{0xd5,0xaa,0xe4,0x98,0xad},{0xd5,0xaa,0xe4,0x88,0xad},{0xd5,0xaa,0xe4,0x80,0xad},{0xd5,0xaa,0xe4,0x91,0xad},{0xd5,0xaa,0xe4,0x84,0xad},{0xd5,0xaa,0xe4,0x94,0xad},{0xd5,0xaa,0xe4,0x20,0xad} },
+    { {0xd5,0xaa,0xe4,0x10,0xad},{0xd5,0xaa,0xe4,0x30,0xad},{0xd5,0xaa,0xe4,0x98,0xad},{0xd5,0xaa,0xe4,0x98,0xad},{0xd5,0xaa,0xe4,0x90,0xad},{0xd5,0xaa,0xe4,0x91,0xad},{0xd5,0xaa,0xe4,0x94,0xad},{0xd5,0xaa,0xe4,0x94,0xad},{0xd5,0xaa,0xe4,0x30,0xad} },
+    { {0xd5,0xaa,0xe4,0x08,0xad},{0xd5,0xaa,0xe4,0x28,0xad},{0xd5,0xaa,0xe4,0x98,0xad},{0xd5,0xaa,0xe4,0x88,0xad},{0xd5,0xaa,0xe4,0x88,0xad},{0xd5,0xaa,0xe4,0x99,0xad},{0xd5,0xaa,0xe4,0x8c,0xad},{0xd5,0xaa,0xe4,0x9c,0xad},{0xd5,0xaa,0xe4,0x28,0xad} },
+    { {0xd5,0xaa,0xe4,0x18,0xad},{0xd5,0xaa,0xe4,0x38,0xad},{0xd5,0xaa,0xe4,0x98,0xad},{0xd5,0xaa,0xe4,0x98,0xad},{0xd5,0xaa,0xe4,0x98,0xad},{0xd5,0xaa,0xe4,0x99,0xad},{0xd5,0xaa,0xe4,0x9c,0xad},{0xd5,0xaa,0xe4,0x9c,0xad},{0xd5,0xaa,0xe4,0x38,0xad} },
+    { {0xd5,0xaa,0xe4,0x40,0xad},{0xd5,0xaa,0xe4,0x60,0xad},{0xd5,0xaa,0xe4,0xd8,0xad},{0xd5,0xaa,0xe4,0xc8,0xad},{0xd5,0xaa,0xe4,0xc0,0xad},{0xd5,0xaa,0xe4,0xd1,0xad},{0xd5,0xaa,0xe4,0xc4,0xad},{0xd5,0xaa,0xe4,0xd4,0xad},{0xd5,0xaa,0xe4,0x60,0xad} },
+    { {0xd5,0xaa,0xe4,0x50,0xad},{0xd5,0xaa,0xe4,0x70,0xad},{0xd5,0xaa,0xe4,0xd8,0xad},{0xd5,0xaa,0xe4,0xd8,0xad},{0xd5,0xaa,0xe4,0xd0,0xad},{0xd5,0xaa,0xe4,0xd1,0xad},{0xd5,0xaa,0xe4,0xd4,0xad},{0xd5,0xaa,0xe4,0xd4,0xad},{0xd5,0xaa,0xe4,0x70,0xad} },
+    { {0xd5,0xaa,0xe4,0x48,0xad},{0xd5,0xaa,0xe4,0x68,0xad},{0xd5,0xaa,0xe4,0xd8,0xad},{0xd5,0xaa,0xe4,0xc8,0xad},{0xd5,0xaa,0xe4,0xc8,0xad},{0xd5,0xaa,0xe4,0xd9,0xad},{0xd5,0xaa,0xe4,0xcc,0xad},{0xd5,0xaa,0xe4,0xdc,0xad},{0xd5,0xaa,0xe4,0x68,0xad} },
+    { {0xd5,0xaa,0xe4,0x58,0xad},{0xd5,0xaa,0xe4,0x78,0xad},{0xd5,0xaa,0xe4,0xd8,0xad},{0xd5,0xaa,0xe4,0xd8,0xad},{0xd5,0xaa,0xe4,0xd8,0xad},{0xd5,0xaa,0xe4,0xd9,0xad},{0xd5,0xaa,0xe4,0xdc,0xad},{0xd5,0xaa,0xe4,0xdc,0xad},{0xd5,0xaa,0xe4,0x78,0xad} }
+  },
+  { /* J */
+    { {0xd5,0xaa,0xf0,0x00,0xad},{0xd5,0xaa,0xf0,0x20,0xad},{0xd5,0xaa,0xf0,0x98,0xad},{0xd5,0xaa,0xf0,0x88,0xad},{0xd5,0xaa,0xf0,0x80,0xad},{0xd5,0xaa,0xf0,0x91,0xad},{0xd5,0xaa,0xf0,0x84,0xad},{0xd5,0xaa,0xf0,0x94,0xad},{0xd5,0xaa,0xf0,0x20,0xad} },
+    { {0xd5,0xaa,0xf0,0x10,0xad},{0xd5,0xaa,0xf0,0x30,0xad},{0xd5,0xaa,0xf0,0x98,0xad},{0xd5,0xaa,0xf0,0x98,0xad},{0xd5,0xaa,0xf0,0x90,0xad},{0xd5,0xaa,0xf0,0x91,0xad},{0xd5,0xaa,0xf0,0x94,0xad},{0xd5,0xaa,0xf0,0x94,0xad},{0xd5,0xaa,0xf0,0x30,0xad} },
+    { {0xd5,0xaa,0xf0,0x08,0xad},{0xd5,0xaa,0xf0,0x28,0xad},{0xd5,0xaa,0xf0,0x98,0xad},{0xd5,0xaa,0xf0,0x88,0xad},{0xd5,0xaa,0xf0,0x88,0xad},{0xd5,0xaa,0xf0,0x99,0xad},{0xd5,0xaa,0xf0,0x8c,0xad},{0xd5,0xaa,0xf0,0x9c,0xad},{0xd5,0xaa,0xf0,0x28,0xad} },
+    { {0xd5,0xaa,0xf0,0x18,0xad},{0xd5,0xaa,0xf0,0x38,0xad},{0xd5,0xaa,0xf0,0x98,0xad},{0xd5,0xaa,0xf0,0x98,0xad},{0xd5,0xaa,0xf0,0x98,0xad},{0xd5,0xaa,0xf0,0x99,0xad},{0xd5,0xaa,0xf0,0x9c,0xad},{0xd5,0xaa,0xf0,0x9c,0xad},{0xd5,0xaa,0xf0,0x38,0xad} },
+    { {0xd5,0xaa,0xf0,0x40,0xad},{0xd5,0xaa,0xf0,0x60,0xad},{0xd5,0xaa,0xf0,0xd8,0xad},{0xd5,0xaa,0xf0,0xc8,0xad},{0xd5,0xaa,0xf0,0xc0,0xad},{0xd5,0xaa,0xf0,0xd1,0xad},{0xd5,0xaa,0xf0,0xc4,0xad},{0xd5,0xaa,0xf0,0xd4,0xad},{0xd5,0xaa,0xf0,0x60,0xad} },
+    { {0xd5,0xaa,0xf0,0x50,0xad},{0xd5,0xaa,0xf0,0x70,0xad},{0xd5,0xaa,0xf0,0xd8,0xad},{0xd5,0xaa,0xf0,0xd8,0xad},{0xd5,0xaa,0xf0,0xd0,0xad},{0xd5,0xaa,0xf0,0xd1,0xad},{0xd5,0xaa,0xf0,0xd4,0xad},{0xd5,0xaa,0xf0,0xd4,0xad},{0xd5,0xaa,0xf0,0x70,0xad} },
+    { {0xd5,0xaa,0xf0,0x48,0xad},{0xd5,0xaa,0xf0,0x68,0xad},{0xd5,0xaa,0xf0,0xd8,0xad},{0xd5,0xaa,0xf0,0xc8,0xad},{0xd5,0xaa,0xf0,0xc8,0xad},{0xd5,0xaa,0xf0,0xd9,0xad},{0xd5,0xaa,0xf0,0xcc,0xad},{0xd5,0xaa,0xf0,0xdc,0xad},{0xd5,0xaa,0xf0,0x68,0xad} },
+    { {0xd5,0xaa,0xf0,0x58,0xad},{0xd5,0xaa,0xf0,0x78,0xad},{0xd5,0xaa,0xf0,0xd8,0xad},{0xd5,0xaa,0xf0,0xd8,0xad},{0xd5,0xaa,0xf0,0xd8,0xad},{0xd5,0xaa,0xf0,0xd9,0xad},{0xd5,0xaa,0xf0,0xdc,0xad},{0xd5,0xaa,0xf0,0xdc,0xad},{0xd5,0xaa,0xf0,0x78,0xad} },
+    { {0xd5,0xaa,0xf4,0x00,0xad},{0xd5,0xaa,0xf4,0x20,0xad},{0xd5,0xaa,0xf4,0x98,0xad},{0xd5,0xaa,0xf4,0x88,0xad},{0xd5,0xaa,0xf4,0x80,0xad},{0xd5,0xaa,0xf4,0x91,0xad},{0xd5,0xaa,0xf4,0x84,0xad},{0xd5,0xaa,0xf4,0x94,0xad},{0xd5,0xaa,0xf4,0x20,0xad} },
+    { {0xd5,0xaa,0xf4,0x10,0xad},{0xd5,0xaa,0xf4,0x30,0xad},{0xd5,0xaa,0xf4,0x98,0xad},{0xd5,0xaa,0xf4,0x98,0xad},{0xd5,0xaa,0xf4,0x90,0xad},{0xd5,0xaa,0xf4,0x91,0xad},{0xd5,0xaa,0xf4,0x94,0xad},{0xd5,0xaa,0xf4,0x94,0xad},{0xd5,0xaa,0xf4,0x30,0xad} },
+    { {0xd5,0xaa,0xf4,0x08,0xad},{0xd5,0xaa,0xf4,0x28,0xad},{0xd5,0xaa,0xf4,0x98,0xad},{0xd5,0xaa,0xf4,0x88,0xad},{0xd5,0xaa,0xf4,0x88,0xad},{0xd5,0xaa,0xf4,0x99,0xad},{0xd5,0xaa,0xf4,0x8c,0xad},{0xd5,0xaa,0xf4,0x9c,0xad},{0xd5,0xaa,0xf4,0x28,0xad} },
+    { {0xd5,0xaa,0xf4,0x18,0xad},{0xd5,0xaa,0xf4,0x38,0xad},{0xd5,0xaa,0xf4,0x98,0xad},{0xd5,0xaa,0xf4,0x98,0xad},{0xd5,0xaa,0xf4,0x98,0xad},{0xd5,0xaa,0xf4,0x99,0xad},{0xd5,0xaa,0xf4,0x9c,0xad},{0xd5,0xaa,0xf4,0x9c,0xad},{0xd5,0xaa,0xf4,0x38,0xad} },
+    { {0xd5,0xaa,0xf4,0x40,0xad},{0xd5,0xaa,0xf4,0x60,0xad},{0xd5,0xaa,0xf4,0xd8,0xad},{0xd5,0xaa,0xf4,0xc8,0xad},{0xd5,0xaa,0xf4,0xc0,0xad},{0xd5,0xaa,0xf4,0xd1,0xad},{0xd5,0xaa,0xf4,0xc4,0xad},{0xd5,0xaa,0xf4,0xd4,0xad},{0xd5,0xaa,0xf4,0x60,0xad} },
+    { {0xd5,0xaa,0xf4,0x50,0xad},{0xd5,0xaa,0xf4,0x70,0xad},{0xd5,0xaa,0xf4,0xd8,0xad},{0xd5,0xaa,0xf4,0xd8,0xad},{0xd5,0xaa,0xf4,0xd0,0xad},{0xd5,0xaa,0xf4,0xd1,0xad},{0xd5,0xaa,0xf4,0xd4,0xad},{0xd5,0xaa,0xf4,0xd4,0xad},{0xd5,0xaa,0xf4,0x70,0xad} },
+    { {0xd5,0xaa,0xf4,0x48,0xad},{0xd5,0xaa,0xf4,0x68,0xad},{0xd5,0xaa,0xf4,0xd8,0xad},{0xd5,0xaa,0xf4,0xc8,0xad},{0xd5,0xaa,0xf4,0xc8,0xad},{0xd5,0xaa,0xf4,0xd9,0xad},{0xd5,0xaa,0xf4,0xcc,0xad},{0xd5,0xaa,0xf4,0xdc,0xad},{0xd5,0xaa,0xf4,0x68,0xad} },
+    { {0xd5,0xaa,0xf4,0x58,0xad},{0xd5,0xaa,0xf4,0x78,0xad},{0xd5,0xaa,0xf4,0xd8,0xad},{0xd5,0xaa,0xf4,0xd8,0xad},{0xd5,0xaa,0xf4,0xd8,0xad},{0xd5,0xaa,0xf4,0xd9,0xad},{0xd5,0xaa,0xf4,0xdc,0xad},{0xd5,0xaa,0xf4,0xdc,0xad},{0xd5,0xaa,0xf4,0x78,0xad} }
+  },
+  { /* K */
+    { {0xd5,0xaa,0xc0,0x00,0xad},{0xd5,0xaa,0xc0,0x20,0xad},{0xd5,0xaa,0xc0,0x98,0xad},{0xd5,0xaa,0xc0,0x88,0xad},{0xd5,0xaa,0xc0,0x80,0xad},{0xd5,0xaa,0xc0,0x91,0xad},{0xd5,0xaa,0xc0,0x84,0xad},{0xd5,0xaa,0xc0,0x94,0xad},{0xd5,0xaa,0xc0,0x20,0xad} },
+    { {0xd5,0xaa,0xc0,0x10,0xad},{0xd5,0xaa,0xc0,0x30,0xad},{0xd5,0xaa,0xc0,0x98,0xad},{0xd5,0xaa,0xc0,0x98,0xad},{0xd5,0xaa,0xc0,0x90,0xad},{0xd5,0xaa,0xc0,0x91,0xad},{0xd5,0xaa,0xc0,0x94,0xad},{0xd5,0xaa,0xc0,0x94,0xad},{0xd5,0xaa,0xc0,0x30,0xad} },
+    { {0xd5,0xaa,0xc0,0x08,0xad},{0xd5,0xaa,0xc0,0x28,0xad},{0xd5,0xaa,0xc0,0x98,0xad},{0xd5,0xaa,0xc0,0x88,0xad},{0xd5,0xaa,0xc0,0x88,0xad},{0xd5,0xaa,0xc0,0x99,0xad},{0xd5,0xaa,0xc0,0x8c,0xad},{0xd5,0xaa,0xc0,0x9c,0xad},{0xd5,0xaa,0xc0,0x28,0xad} },
+    { {0xd5,0xaa,0xc0,0x18,0xad},{0xd5,0xaa,0xc0,0x38,0xad},{0xd5,0xaa,0xc0,0x98,0xad},{0xd5,0xaa,0xc0,0x98,0xad},{0xd5,0xaa,0xc0,0x98,0xad},{0xd5,0xaa,0xc0,0x99,0xad},{0xd5,0xaa,0xc0,0x9c,0xad},{0xd5,0xaa,0xc0,0x9c,0xad},{0xd5,0xaa,0xc0,0x38,0xad} },
+    { {0xd5,0xaa,0xc0,0x40,0xad},{0xd5,0xaa,0xc0,0x60,0xad},{0xd5,0xaa,0xc0,0xd8,0xad},{0xd5,0xaa,0xc0,0xc8,0xad},{0xd5,0xaa,0xc0,0xc0,0xad},{0xd5,0xaa,0xc0,0xd1,0xad},{0xd5,0xaa,0xc0,0xc4,0xad},{0xd5,0xaa,0xc0,0xd4,0xad},{0xd5,0xaa,0xc0,0x60,0xad} },
+    { {0xd5,0xaa,0xc0,0x50,0xad},{0xd5,0xaa,0xc0,0x70,0xad},{0xd5,0xaa,0xc0,0xd8,0xad},{0xd5,0xaa,0xc0,0xd8,0xad},{0xd5,0xaa,0xc0,0xd0,0xad},{0xd5,0xaa,0xc0,0xd1,0xad},{0xd5,0xaa,0xc0,0xd4,0xad},{0xd5,0xaa,0xc0,0xd4,0xad},{0xd5,0xaa,0xc0,0x70,0xad} },
+    { {0xd5,0xaa,0xc0,0x48,0xad},{0xd5,0xaa,0xc0,0x68,0xad},{0xd5,0xaa,0xc0,0xd8,0xad},{0xd5,0xaa,0xc0,0xc8,0xad},{0xd5,0xaa,0xc0,0xc8,0xad},{0xd5,0xaa,0xc0,0xd9,0xad},{0xd5,0xaa,0xc0,0xcc,0xad},{0xd5,0xaa,0xc0,0xdc,0xad},{0xd5,0xaa,0xc0,0x68,0xad} },
+    { {0xd5,0xaa,0xc0,0x58,0xad},{0xd5,0xaa,0xc0,0x78,0xad},{0xd5,0xaa,0xc0,0xd8,0xad},{0xd5,0xaa,0xc0,0xd8,0xad},{0xd5,0xaa,0xc0,0xd8,0xad},{0xd5,0xaa,0xc0,0xd9,0xad},{0xd5,0xaa,0xc0,0xdc,0xad},{0xd5,0xaa,0xc0,0xdc,0xad},{0xd5,0xaa,0xc0,0x78,0xad} },
+    { {0xd5,0xaa,0xc4,0x00,0xad},{0xd5,0xaa,0xc4,0x20,0xad},{0xd5,0xaa,0xc4,0x98,0xad},{0xd5,0xaa,0xc4,0x88,0xad},{0xd5,0xaa,0xc4,0x80,0xad},{0xd5,0xaa,0xc4,0x91,0xad},{0xd5,0xaa,0xc4,0x84,0xad},{0xd5,0xaa,0xc4,0x94,0xad},{0xd5,0xaa,0xc4,0x20,0xad} },
+    { {0xd5,0xaa,0xc4,0x10,0xad},{0xd5,0xaa,0xc4,0x30,0xad},{0xd5,0xaa,0xc4,0x98,0xad},{0xd5,0xaa,0xc4,0x98,0xad},{0xd5,0xaa,0xc4,0x90,0xad},{0xd5,0xaa,0xc4,0x91,0xad},{0xd5,0xaa,0xc4,0x94,0xad},{0xd5,0xaa,0xc4,0x94,0xad},{0xd5,0xaa,0xc4,0x30,0xad} },
+    { {0xd5,0xaa,0xc4,0x08,0xad},{0xd5,0xaa,0xc4,0x28,0xad},{0xd5,0xaa,0xc4,0x98,0xad},{0xd5,0xaa,0xc4,0x88,0xad},{0xd5,0xaa,0xc4,0x88,0xad},{0xd5,0xaa,0xc4,0x99,0xad},{0xd5,0xaa,0xc4,0x8c,0xad},{0xd5,0xaa,0xc4,0x9c,0xad},{0xd5,0xaa,0xc4,0x28,0xad} },
+    { {0xd5,0xaa,0xc4,0x18,0xad},{0xd5,0xaa,0xc4,0x38,0xad},{0xd5,0xaa,0xc4,0x98,0xad},{0xd5,0xaa,0xc4,0x98,0xad},{0xd5,0xaa,0xc4,0x98,0xad},{0xd5,0xaa,0xc4,0x99,0xad},{0xd5,0xaa,0xc4,0x9c,0xad},{0xd5,0xaa,0xc4,0x9c,0xad},{0xd5,0xaa,0xc4,0x38,0xad} },
+    { {0xd5,0xaa,0xc4,0x40,0xad},{0xd5,0xaa,0xc4,0x60,0xad},{0xd5,0xaa,0xc4,0xd8,0xad},{0xd5,0xaa,0xc4,0xc8,0xad},{0xd5,0xaa,0xc4,0xc0,0xad},{0xd5,0xaa,0xc4,0xd1,0xad},{0xd5,0xaa,0xc4,0xc4,0xad},{0xd5,0xaa,0xc4,0xd4,0xad},{0xd5,0xaa,0xc4,0x60,0xad} },
+    { {0xd5,0xaa,0xc4,0x50,0xad},{0xd5,0xaa,0xc4,0x70,0xad},{0xd5,0xaa,0xc4,0xd8,0xad},{0xd5,0xaa,0xc4,0xd8,0xad},{0xd5,0xaa,0xc4,0xd0,0xad},{0xd5,0xaa,0xc4,0xd1,0xad},{0xd5,0xaa,0xc4,0xd4,0xad},{0xd5,0xaa,0xc4,0xd4,0xad},{0xd5,0xaa,0xc4,0x70,0xad} },
+    { {0xd5,0xaa,0xc4,0x48,0xad},{0xd5,0xaa,0xc4,0x68,0xad},{0xd5,0xaa,0xc4,0xd8,0xad},{0xd5,0xaa,0xc4,0xc8,0xad},{0xd5,0xaa,0xc4,0xc8,0xad},{0xd5,0xaa,0xc4,0xd9,0xad},{0xd5,0xaa,0xc4,0xcc,0xad},{0xd5,0xaa,0xc4,0xdc,0xad},{0xd5,0xaa,0xc4,0x68,0xad} },
+    { {0xd5,0xaa,0xc4,0x58,0xad},{0xd5,0xaa,0xc4,0x78,0xad},{0xd5,0xaa,0xc4,0xd8,0xad},{0xd5,0xaa,0xc4,0xd8,0xad},{0xd5,0xaa,0xc4,0xd8,0xad},{0xd5,0xaa,0xc4,0xd9,0xad},{0xd5,0xaa,0xc4,0xdc,0xad},{0xd5,0xaa,0xc4,0xdc,0xad},{0xd5,0xaa,0xc4,0x78,0xad} }
+  },
+  { /* L */
+    { {0xd5,0xaa,0xd0,0x00,0xad},{0xd5,0xaa,0xd0,0x20,0xad},{0xd5,0xaa,0xd0,0x98,0xad},{0xd5,0xaa,0xd0,0x88,0xad},{0xd5,0xaa,0xd0,0x80,0xad},{0xd5,0xaa,0xd0,0x91,0xad},{0xd5,0xaa,0xd0,0x84,0xad},{0xd5,0xaa,0xd0,0x94,0xad},{0xd5,0xaa,0xd0,0x20,0xad} },
+    { {0xd5,0xaa,0xd0,0x10,0xad},{0xd5,0xaa,0xd0,0x30,0xad},{0xd5,0xaa,0xd0,0x98,0xad},{0xd5,0xaa,0xd0,0x98,0xad},{0xd5,0xaa,0xd0,0x90,0xad},{0xd5,0xaa,0xd0,0x91,0xad},{0xd5,0xaa,0xd0,0x94,0xad},{0xd5,0xaa,0xd0,0x94,0xad},{0xd5,0xaa,0xd0,0x30,0xad} },
+    { {0xd5,0xaa,0xd0,0x08,0xad},{0xd5,0xaa,0xd0,0x28,0xad},{0xd5,0xaa,0xd0,0x98,0xad},{0xd5,0xaa,0xd0,0x88,0xad},{0xd5,0xaa,0xd0,0x88,0xad},{0xd5,0xaa,0xd0,0x99,0xad},{0xd5,0xaa,0xd0,0x8c,0xad},{0xd5,0xaa,0xd0,0x9c,0xad},{0xd5,0xaa,0xd0,0x28,0xad} },
+    { {0xd5,0xaa,0xd0,0x18,0xad},{0xd5,0xaa,0xd0,0x38,0xad},{0xd5,0xaa,0xd0,0x98,0xad},{0xd5,0xaa,0xd0,0x98,0xad},{0xd5,0xaa,0xd0,0x98,0xad},{0xd5,0xaa,0xd0,0x99,0xad},{0xd5,0xaa,0xd0,0x9c,0xad},{0xd5,0xaa,0xd0,0x9c,0xad},{0xd5,0xaa,0xd0,0x38,0xad} },
+    { {0xd5,0xaa,0xd0,0x40,0xad},{0xd5,0xaa,0xd0,0x60,0xad},{0xd5,0xaa,0xd0,0xd8,0xad},{0xd5,0xaa,0xd0,0xc8,0xad},{0xd5,0xaa,0xd0,0xc0,0xad},{0xd5,0xaa,0xd0,0xd1,0xad},{0xd5,0xaa,0xd0,0xc4,0xad},{0xd5,0xaa,0xd0,0xd4,0xad},{0xd5,0xaa,0xd0,0x60,0xad} },
+    { {0xd5,0xaa,0xd0,0x50,0xad},{0xd5,0xaa,0xd0,0x70,0xad},{0xd5,0xaa,0xd0,0xd8,0xad},{0xd5,0xaa,0xd0,0xd8,0xad},{0xd5,0xaa,0xd0,0xd0,0xad},{0xd5,0xaa,0xd0,0xd1,0xad},{0xd5,0xaa,0xd0,0xd4,0xad},{0xd5,0xaa,0xd0,0xd4,0xad},{0xd5,0xaa,0xd0,0x70,0xad} },
+    { {0xd5,0xaa,0xd0,0x48,0xad},{0xd5,0xaa,0xd0,0x68,0xad},{0xd5,0xaa,0xd0,0xd8,0xad},{0xd5,0xaa,0xd0,0xc8,0xad},{0xd5,0xaa,0xd0,0xc8,0xad},{0xd5,0xaa,0xd0,0xd9,0xad},{0xd5,0xaa,0xd0,0xcc,0xad},{0xd5,0xaa,0xd0,0xdc,0xad},{0xd5,0xaa,0xd0,0x68,0xad} },
+    { {0xd5,0xaa,0xd0,0x58,0xad},{0xd5,0xaa,0xd0,0x78,0xad},{0xd5,0xaa,0xd0,0xd8,0xad},{0xd5,0xaa,0xd0,0xd8,0xad},{0xd5,0xaa,0xd0,0xd8,0xad},{0xd5,0xaa,0xd0,0xd9,0xad},{0xd5,0xaa,0xd0,0xdc,0xad},{0xd5,0xaa,0xd0,0xdc,0xad},{0xd5,0xaa,0xd0,0x78,0xad} },
+    { {0xd5,0xaa,0xd4,0x00,0xad},{0xd5,0xaa,0xd4,0x20,0xad},{0xd5,0xaa,0xd4,0x98,0xad},{0xd5,0xaa,0xd4,0x88,0xad},{0xd5,0xaa,0xd4,0x80,0xad},{0xd5,0xaa,0xd4,0x91,0xad},{0xd5,0xaa,0xd4,0x84,0xad},{0xd5,0xaa,0xd4,0x94,0xad},{0xd5,0xaa,0xd4,0x20,0xad} },
+    { {0xd5,0xaa,0xd4,0x10,0xad},{0xd5,0xaa,0xd4,0x30,0xad},{0xd5,0xaa,0xd4,0x98,0xad},{0xd5,0xaa,0xd4,0x98,0xad},{0xd5,0xaa,0xd4,0x90,0xad},{0xd5,0xaa,0xd4,0x91,0xad},{0xd5,0xaa,0xd4,0x94,0xad},{0xd5,0xaa,0xd4,0x94,0xad},{0xd5,0xaa,0xd4,0x30,0xad} },
+    { {0xd5,0xaa,0xd4,0x08,0xad},{0xd5,0xaa,0xd4,0x28,0xad},{0xd5,0xaa,0xd4,0x98,0xad},{0xd5,0xaa,0xd4,0x88,0xad},{0xd5,0xaa,0xd4,0x88,0xad},{0xd5,0xaa,0xd4,0x99,0xad},{0xd5,0xaa,0xd4,0x8c,0xad},{0xd5,0xaa,0xd4,0x9c,0xad},{0xd5,0xaa,0xd4,0x28,0xad} },
+    { {0xd5,0xaa,0xd4,0x18,0xad},{0xd5,0xaa,0xd4,0x38,0xad},{0xd5,0xaa,0xd4,0x98,0xad},{0xd5,0xaa,0xd4,0x98,0xad},{0xd5,0xaa,0xd4,0x98,0xad},{0xd5,0xaa,0xd4,0x99,0xad},{0xd5,0xaa,0xd4,0x9c,0xad},{0xd5,0xaa,0xd4,0x9c,0xad},{0xd5,0xaa,0xd4,0x38,0xad} },
+    { {0xd5,0xaa,0xd4,0x40,0xad},{0xd5,0xaa,0xd4,0x60,0xad},{0xd5,0xaa,0xd4,0xd8,0xad},{0xd5,0xaa,0xd4,0xc8,0xad},{0xd5,0xaa,0xd4,0xc0,0xad},{0xd5,0xaa,0xd4,0xd1,0xad},{0xd5,0xaa,0xd4,0xc4,0xad},{0xd5,0xaa,0xd4,0xd4,0xad},{0xd5,0xaa,0xd4,0x60,0xad} },
+    { {0xd5,0xaa,0xd4,0x50,0xad},{0xd5,0xaa,0xd4,0x70,0xad},{0xd5,0xaa,0xd4,0xd8,0xad},{0xd5,0xaa,0xd4,0xd8,0xad},{0xd5,0xaa,0xd4,0xd0,0xad},{0xd5,0xaa,0xd4,0xd1,0xad},{0xd5,0xaa,0xd4,0xd4,0xad},{0xd5,0xaa,0xd4,0xd4,0xad},{0xd5,0xaa,0xd4,0x70,0xad} },
+    { {0xd5,0xaa,0xd4,0x48,0xad},{0xd5,0xaa,0xd4,0x68,0xad},{0xd5,0xaa,0xd4,0xd8,0xad},{0xd5,0xaa,0xd4,0xc8,0xad},{0xd5,0xaa,0xd4,0xc8,0xad},{0xd5,0xaa,0xd4,0xd9,0xad},{0xd5,0xaa,0xd4,0xcc,0xad},{0xd5,0xaa,0xd4,0xdc,0xad},{0xd5,0xaa,0xd4,0x68,0xad} },
+    { {0xd5,0xaa,0xd4,0x58,0xad},{0xd5,0xaa,0xd4,0x78,0xad},{0xd5,0xaa,0xd4,0xd8,0xad},{0xd5,0xaa,0xd4,0xd8,0xad},{0xd5,0xaa,0xd4,0xd8,0xad},{0xd5,0xaa,0xd4,0xd9,0xad},{0xd5,0xaa,0xd4,0xdc,0xad},{0xd5,0xaa,0xd4,0xdc,0xad},{0xd5,0xaa,0xd4,0x78,0xad} }
+  },
+  { /* M */
+    { {0xd5,0xaa,0x00,0x00,0xad},{0xd5,0xaa,0x00,0x20,0xad},{0xd5,0xaa,0x00,0x98,0xad},{0xd5,0xaa,0x00,0x88,0xad},{0xd5,0xaa,0x00,0x80,0xad},{0xd5,0xaa,0x00,0x91,0xad},{0xd5,0xaa,0x00,0x84,0xad},{0xd5,0xaa,0x00,0x94,0xad},{0xd5,0xaa,0x00,0x20,0xad} },
+    { {0xd5,0xaa,0x00,0x10,0xad},{0xd5,0xaa,0x00,0x30,0xad},{0xd5,0xaa,0x00,0x98,0xad},{0xd5,0xaa,0x00,0x98,0xad},{0xd5,0xaa,0x00,0x90,0xad},{0xd5,0xaa,0x00,0x91,0xad},{0xd5,0xaa,0x00,0x94,0xad},{0xd5,0xaa,0x00,0x94,0xad},{0xd5,0xaa,0x00,0x30,0xad} },
+    { {0xd5,0xaa,0x00,0x08,0xad},{0xd5,0xaa,0x00,0x28,0xad},{0xd5,0xaa,0x00,0x98,0xad},{0xd5,0xaa,0x00,0x88,0xad},{0xd5,0xaa,0x00,0x88,0xad},{0xd5,0xaa,0x00,0x99,0xad},{0xd5,0xaa,0x00,0x8c,0xad},{0xd5,0xaa,0x00,0x9c,0xad},{0xd5,0xaa,0x00,0x28,0xad} },
+    { {0xd5,0xaa,0x00,0x18,0xad},{0xd5,0xaa,0x00,0x38,0xad},{0xd5,0xaa,0x00,0x98,0xad},{0xd5,0xaa,0x00,0x98,0xad},{0xd5,0xaa,0x00,0x98,0xad},{0xd5,0xaa,0x00,0x99,0xad},{0xd5,0xaa,0x00,0x9c,0xad},{0xd5,0xaa,0x00,0x9c,0xad},{0xd5,0xaa,0x00,0x38,0xad} },
+    { {0xd5,0xaa,0x00,0x40,0xad},{0xd5,0xaa,0x00,0x60,0xad},{0xd5,0xaa,0x00,0xd8,0xad},{0xd5,0xaa,0x00,0xc8,0xad},{0xd5,0xaa,0x00,0xc0,0xad},{0xd5,0xaa,0x00,0xd1,0xad},{0xd5,0xaa,0x00,0xc4,0xad},{0xd5,0xaa,0x00,0xd4,0xad},{0xd5,0xaa,0x00,0x60,0xad} },
+    { {0xd5,0xaa,0x00,0x50,0xad},{0xd5,0xaa,0x00,0x70,0xad},{0xd5,0xaa,0x00,0xd8,0xad},{0xd5,0xaa,0x00,0xd8,0xad},{0xd5,0xaa,0x00,0xd0,0xad},{0xd5,0xaa,0x00,0xd1,0xad},{0xd5,0xaa,0x00,0xd4,0xad},{0xd5,0xaa,0x00,0xd4,0xad},{0xd5,0xaa,0x00,0x70,0xad} },
+    { {0xd5,0xaa,0x00,0x48,0xad},{0xd5,0xaa,0x00,0x68,0xad},{0xd5,0xaa,0x00,0xd8,0xad},{0xd5,0xaa,0x00,0xc8,0xad},{0xd5,0xaa,0x00,0xc8,0xad},{0xd5,0xaa,0x00,0xd9,0xad},{0xd5,0xaa,0x00,0xcc,0xad},{0xd5,0xaa,0x00,0xdc,0xad},{0xd5,0xaa,0x00,0x68,0xad} },
+    { {0xd5,0xaa,0x00,0x58,0xad},{0xd5,0xaa,0x00,0x78,0xad},{0xd5,0xaa,0x00,0xd8,0xad},{0xd5,0xaa,0x00,0xd8,0xad},{0xd5,0xaa,0x00,0xd8,0xad},{0xd5,0xaa,0x00,0xd9,0xad},{0xd5,0xaa,0x00,0xdc,0xad},{0xd5,0xaa,0x00,0xdc,0xad},{0xd5,0xaa,0x00,0x78,0xad} },
+    { {0xd5,0xaa,0x04,0x00,0xad},{0xd5,0xaa,0x04,0x20,0xad},{0xd5,0xaa,0x04,0x98,0xad},{0xd5,0xaa,0x04,0x88,0xad},{0xd5,0xaa,0x04,0x80,0xad},{0xd5,0xaa,0x04,0x91,0xad},{0xd5,0xaa,0x04,0x84,0xad},{0xd5,0xaa,0x04,0x94,0xad},{0xd5,0xaa,0x04,0x20,0xad} },
+    { {0xd5,0xaa,0x04,0x10,0xad},{0xd5,0xaa,0x04,0x30,0xad},{0xd5,0xaa,0x04,0x98,0xad},{0xd5,0xaa,0x04,0x98,0xad},{0xd5,0xaa,0x04,0x90,0xad},{0xd5,0xaa,0x04,0x91,0xad},{0xd5,0xaa,0x04,0x94,0xad},{0xd5,0xaa,0x04,0x94,0xad},{0xd5,0xaa,0x04,0x30,0xad} },
+    { {0xd5,0xaa,0x04,0x08,0xad},{0xd5,0xaa,0x04,0x28,0xad},{0xd5,0xaa,0x04,0x98,0xad},{0xd5,0xaa,0x04,0x88,0xad},{0xd5,0xaa,0x04,0x88,0xad},{0xd5,0xaa,0x04,0x99,0xad},{0xd5,0xaa,0x04,0x8c,0xad},{0xd5,0xaa,0x04,0x9c,0xad},{0xd5,0xaa,0x04,0x28,0xad} },
+    { {0xd5,0xaa,0x04,0x18,0xad},{0xd5,0xaa,0x04,0x38,0xad},{0xd5,0xaa,0x04,0x98,0xad},{0xd5,0xaa,0x04,0x98,0xad},{0xd5,0xaa,0x04,0x98,0xad},{0xd5,0xaa,0x04,0x99,0xad},{0xd5,0xaa,0x04,0x9c,0xad},{0xd5,0xaa,0x04,0x9c,0xad},{0xd5,0xaa,0x04,0x38,0xad} },
+    { {0xd5,0xaa,0x04,0x40,0xad},{0xd5,0xaa,0x04,0x60,0xad},{0xd5,0xaa,0x04,0xd8,0xad},{0xd5,0xaa,0x04,0xc8,0xad},{0xd5,0xaa,0x04,0xc0,0xad},{0xd5,0xaa,0x04,0xd1,0xad},{0xd5,0xaa,0x04,0xc4,0xad},{0xd5,0xaa,0x04,0xd4,0xad},{0xd5,0xaa,0x04,0x60,0xad} },
+    { {0xd5,0xaa,0x04,0x50,0xad},{0xd5,0xaa,0x04,0x70,0xad},{0xd5,0xaa,0x04,0xd8,0xad},{0xd5,0xaa,0x04,0xd8,0xad},{0xd5,0xaa,0x04,0xd0,0xad},{0xd5,0xaa,0x04,0xd1,0xad},{0xd5,0xaa,0x04,0xd4,0xad},{0xd5,0xaa,0x04,0xd4,0xad},{0xd5,0xaa,0x04,0x70,0xad} },
+    { {0xd5,0xaa,0x04,0x48,0xad},{0xd5,0xaa,0x04,0x68,0xad},{0xd5,0xaa,0x04,0xd8,0xad},{0xd5,0xaa,0x04,0xc8,0xad},{0xd5,0xaa,0x04,0xc8,0xad},{0xd5,0xaa,0x04,0xd9,0xad},{0xd5,0xaa,0x04,0xcc,0xad},{0xd5,0xaa,0x04,0xdc,0xad},{0xd5,0xaa,0x04,0x68,0xad} },
+    { {0xd5,0xaa,0x04,0x58,0xad},{0xd5,0xaa,0x04,0x78,0xad},{0xd5,0xaa,0x04,0xd8,0xad},{0xd5,0xaa,0x04,0xd8,0xad},{0xd5,0xaa,0x04,0xd8,0xad},{0xd5,0xaa,0x04,0xd9,0xad},{0xd5,0xaa,0x04,0xdc,0xad},{0xd5,0xaa,0x04,0xdc,0xad},{0xd5,0xaa,0x04,0x78,0xad} }
+  },
+  { /* N */
+    { {0xd5,0xaa,0x10,0x00,0xad},{0xd5,0xaa,0x10,0x20,0xad},{0xd5,0xaa,0x10,0x98,0xad},{0xd5,0xaa,0x10,0x88,0xad},{0xd5,0xaa,0x10,0x80,0xad},{0xd5,0xaa,0x10,0x91,0xad},{0xd5,0xaa,0x10,0x84,0xad},{0xd5,0xaa,0x10,0x94,0xad},{0xd5,0xaa,0x10,0x20,0xad} },
+    { {0xd5,0xaa,0x10,0x10,0xad},{0xd5,0xaa,0x10,0x30,0xad},{0xd5,0xaa,0x10,0x98,0xad},{0xd5,0xaa,0x10,0x98,0xad},{0xd5,0xaa,0x10,0x90,0xad},{0xd5,0xaa,0x10,0x91,0xad},{0xd5,0xaa,0x10,0x94,0xad},{0xd5,0xaa,0x10,0x94,0xad},{0xd5,0xaa,0x10,0x30,0xad} },
+    { {0xd5,0xaa,0x10,0x08,0xad},{0xd5,0xaa,0x10,0x28,0xad},{0xd5,0xaa,0x10,0x98,0xad},{0xd5,0xaa,0x10,0x88,0xad},{0xd5,0xaa,0x10,0x88,0xad},{0xd5,0xaa,0x10,0x99,0xad},{0xd5,0xaa,0x10,0x8c,0xad},{0xd5,0xaa,0x10,0x9c,0xad},{0xd5,0xaa,0x10,0x28,0xad} },
+    { {0xd5,0xaa,0x10,0x18,0xad},{0xd5,0xaa,0x10,0x38,0xad},{0xd5,0xaa,0x10,0x98,0xad},{0xd5,0xaa,0x10,0x98,0xad},{0xd5,0xaa,0x10,0x98,0xad},{0xd5,0xaa,0x10,0x99,0xad},{0xd5,0xaa,0x10,0x9c,0xad},{0xd5,0xaa,0x10,0x9c,0xad},{0xd5,0xaa,0x10,0x38,0xad} },
+    { {0xd5,0xaa,0x10,0x40,0xad},{0xd5,0xaa,0x10,0x60,0xad},{0xd5,0xaa,0x10,0xd8,0xad},{0xd5,0xaa,0x10,0xc8,0xad},{0xd5,0xaa,0x10,0xc0,0xad},{0xd5,0xaa,0x10,0xd1,0xad},{0xd5,0xaa,0x10,0xc4,0xad},{0xd5,0xaa,0x10,0xd4,0xad},{0xd5,0xaa,0x10,0x60,0xad} },
+    { {0xd5,0xaa,0x10,0x50,0xad},{0xd5,0xaa,0x10,0x70,0xad},{0xd5,0xaa,0x10,0xd8,0xad},{0xd5,0xaa,0x10,0xd8,0xad},{0xd5,0xaa,0x10,0xd0,0xad},{0xd5,0xaa,0x10,0xd1,0xad},{0xd5,0xaa,0x10,0xd4,0xad},{0xd5,0xaa,0x10,0xd4,0xad},{0xd5,0xaa,0x10,0x70,0xad} },
+    { {0xd5,0xaa,0x10,0x48,0xad},{0xd5,0xaa,0x10,0x68,0xad},{0xd5,0xaa,0x10,0xd8,0xad},{0xd5,0xaa,0x10,0xc8,0xad},{0xd5,0xaa,0x10,0xc8,0xad},{0xd5,0xaa,0x10,0xd9,0xad},{0xd5,0xaa,0x10,0xcc,0xad},{0xd5,0xaa,0x10,0xdc,0xad},{0xd5,0xaa,0x10,0x68,0xad} },
+    { {0xd5,0xaa,0x10,0x58,0xad},{0xd5,0xaa,0x10,0x78,0xad},{0xd5,0xaa,0x10,0xd8,0xad},{0xd5,0xaa,0x10,0xd8,0xad},{0xd5,0xaa,0x10,0xd8,0xad},{0xd5,0xaa,0x10,0xd9,0xad},{0xd5,0xaa,0x10,0xdc,0xad},{0xd5,0xaa,0x10,0xdc,0xad},{0xd5,0xaa,0x10,0x78,0xad} },
+    { {0xd5,0xaa,0x14,0x00,0xad},{0xd5,0xaa,0x14,0x20,0xad},{0xd5,0xaa,0x14,0x98,0xad},{0xd5,0xaa,0x14,0x88,0xad},{0xd5,0xaa,0x14,0x80,0xad},{0xd5,0xaa,0x14,0x91,0xad},{0xd5,0xaa,0x14,0x84,0xad},{0xd5,0xaa,0x14,0x94,0xad},{0xd5,0xaa,0x14,0x20,0xad} },
+    { {0xd5,0xaa,0x14,0x10,0xad},{0xd5,0xaa,0x14,0x30,0xad},{0xd5,0xaa,0x14,0x98,0xad},{0xd5,0xaa,0x14,0x98,0xad},{0xd5,0xaa,0x14,0x90,0xad},{0xd5,0xaa,0x14,0x91,0xad},{0xd5,0xaa,0x14,0x94,0xad},{0xd5,0xaa,0x14,0x94,0xad},{0xd5,0xaa,0x14,0x30,0xad} },
+    { {0xd5,0xaa,0x14,0x08,0xad},{0xd5,0xaa,0x14,0x28,0xad},{0xd5,0xaa,0x14,0x98,0xad},{0xd5,0xaa,0x14,0x88,0xad},{0xd5,0xaa,0x14,0x88,0xad},{0xd5,0xaa,0x14,0x99,0xad},{0xd5,0xaa,0x14,0x8c,0xad},{0xd5,0xaa,0x14,0x9c,0xad},{0xd5,0xaa,0x14,0x28,0xad} },
+    { {0xd5,0xaa,0x14,0x18,0xad},{0xd5,0xaa,0x14,0x38,0xad},{0xd5,0xaa,0x14,0x98,0xad},{0xd5,0xaa,0x14,0x98,0xad},{0xd5,0xaa,0x14,0x98,0xad},{0xd5,0xaa,0x14,0x99,0xad},{0xd5,0xaa,0x14,0x9c,0xad},{0xd5,0xaa,0x14,0x9c,0xad},{0xd5,0xaa,0x14,0x38,0xad} },
+    { {0xd5,0xaa,0x14,0x40,0xad},{0xd5,0xaa,0x14,0x60,0xad},{0xd5,0xaa,0x14,0xd8,0xad},{0xd5,0xaa,0x14,0xc8,0xad},{0xd5,0xaa,0x14,0xc0,0xad},{0xd5,0xaa,0x14,0xd1,0xad},{0xd5,0xaa,0x14,0xc4,0xad},{0xd5,0xaa,0x14,0xd4,0xad},{0xd5,0xaa,0x14,0x60,0xad} },
+    { {0xd5,0xaa,0x14,0x50,0xad},{0xd5,0xaa,0x14,0x70,0xad},{0xd5,0xaa,0x14,0xd8,0xad},{0xd5,0xaa,0x14,0xd8,0xad},{0xd5,0xaa,0x14,0xd0,0xad},{0xd5,0xaa,0x14,0xd1,0xad},{0xd5,0xaa,0x14,0xd4,0xad},{0xd5,0xaa,0x14,0xd4,0xad},{0xd5,0xaa,0x14,0x70,0xad} },
+    { {0xd5,0xaa,0x14,0x48,0xad},{0xd5,0xaa,0x14,0x68,0xad},{0xd5,0xaa,0x14,0xd8,0xad},{0xd5,0xaa,0x14,0xc8,0xad},{0xd5,0xaa,0x14,0xc8,0xad},{0xd5,0xaa,0x14,0xd9,0xad},{0xd5,0xaa,0x14,0xcc,0xad},{0xd5,0xaa,0x14,0xdc,0xad},{0xd5,0xaa,0x14,0x68,0xad} },
+    { {0xd5,0xaa,0x14,0x58,0xad},{0xd5,0xaa,0x14,0x78,0xad},{0xd5,0xaa,0x14,0xd8,0xad},{0xd5,0xaa,0x14,0xd8,0xad},{0xd5,0xaa,0x14,0xd8,0xad},{0xd5,0xaa,0x14,0xd9,0xad},{0xd5,0xaa,0x14,0xdc,0xad},{0xd5,0xaa,0x14,0xdc,0xad},{0xd5,0xaa,0x14,0x78,0xad} }
+  },
+  { /* O */
+    { {0xd5,0xaa,0x20,0x00,0xad},{0xd5,0xaa,0x20,0x20,0xad},{0xd5,0xaa,0x20,0x98,0xad},{0xd5,0xaa,0x20,0x88,0xad},{0xd5,0xaa,0x20,0x80,0xad},{0xd5,0xaa,0x20,0x91,0xad},{0xd5,0xaa,0x20,0x84,0xad},{0xd5,0xaa,0x20,0x94,0xad},{0xd5,0xaa,0x20,0x20,0xad} },
+    { {0xd5,0xaa,0x20,0x10,0xad},{0xd5,0xaa,0x20,0x30,0xad},{0xd5,0xaa,0x20,0x98,0xad},{0xd5,0xaa,0x20,0x98,0xad},{0xd5,0xaa,0x20,0x90,0xad},{0xd5,0xaa,0x20,0x91,0xad},{0xd5,0xaa,0x20,0x94,0xad},{0xd5,0xaa,0x20,0x94,0xad},{0xd5,0xaa,0x20,0x30,0xad} },
+    { {0xd5,0xaa,0x20,0x08,0xad},{0xd5,0xaa,0x20,0x28,0xad},{0xd5,0xaa,0x20,0x98,0xad},{0xd5,0xaa,0x20,0x88,0xad},{0xd5,0xaa,0x20,0x88,0xad},{0xd5,0xaa,0x20,0x99,0xad},{0xd5,0xaa,0x20,0x8c,0xad},{0xd5,0xaa,0x20,0x9c,0xad},{0xd5,0xaa,0x20,0x28,0xad} },
+    { {0xd5,0xaa,0x20,0x18,0xad},{0xd5,0xaa,0x20,0x38,0xad},{0xd5,0xaa,0x20,0x98,0xad},{0xd5,0xaa,0x20,0x98,0xad},{0xd5,0xaa,0x20,0x98,0xad},{0xd5,0xaa,0x20,0x99,0xad},{0xd5,0xaa,0x20,0x9c,0xad},{0xd5,0xaa,0x20,0x9c,0xad},{0xd5,0xaa,0x20,0x38,0xad} },
+    { {0xd5,0xaa,0x20,0x40,0xad},{0xd5,0xaa,0x20,0x60,0xad},{0xd5,0xaa,0x20,0xd8,0xad},{0xd5,0xaa,0x20,0xc8,0xad},{0xd5,0xaa,0x20,0xc0,0xad},{0xd5,0xaa,0x20,0xd1,0xad},{0xd5,0xaa,0x20,0xc4,0xad},{0xd5,0xaa,0x20,0xd4,0xad},{0xd5,0xaa,0x20,0x60,0xad} },
+    { {0xd5,0xaa,0x20,0x50,0xad},{0xd5,0xaa,0x20,0x70,0xad},{0xd5,0xaa,0x20,0xd8,0xad},{0xd5,0xaa,0x20,0xd8,0xad},{0xd5,0xaa,0x20,0xd0,0xad},{0xd5,0xaa,0x20,0xd1,0xad},{0xd5,0xaa,0x20,0xd4,0xad},{0xd5,0xaa,0x20,0xd4,0xad},{0xd5,0xaa,0x20,0x70,0xad} },
+    { {0xd5,0xaa,0x20,0x48,0xad},{0xd5,0xaa,0x20,0x68,0xad},{0xd5,0xaa,0x20,0xd8,0xad},{0xd5,0xaa,0x20,0xc8,0xad},{0xd5,0xaa,0x20,0xc8,0xad},{0xd5,0xaa,0x20,0xd9,0xad},{0xd5,0xaa,0x20,0xcc,0xad},{0xd5,0xaa,0x20,0xdc,0xad},{0xd5,0xaa,0x20,0x68,0xad} },
+    { {0xd5,0xaa,0x20,0x58,0xad},{0xd5,0xaa,0x20,0x78,0xad},{0xd5,0xaa,0x20,0xd8,0xad},{0xd5,0xaa,0x20,0xd8,0xad},{0xd5,0xaa,0x20,0xd8,0xad},{0xd5,0xaa,0x20,0xd9,0xad},{0xd5,0xaa,0x20,0xdc,0xad},{0xd5,0xaa,0x20,0xdc,0xad},{0xd5,0xaa,0x20,0x78,0xad} },
+    { {0xd5,0xaa,0x24,0x00,0xad},{0xd5,0xaa,0x24,0x20,0xad},{0xd5,0xaa,0x24,0x98,0xad},{0xd5,0xaa,0x24,0x88,0xad},{0xd5,0xaa,0x24,0x80,0xad},{0xd5,0xaa,0x24,0x91,0xad},{0xd5,0xaa,0x24,0x84,0xad},{0xd5,0xaa,0x24,0x94,0xad},{0xd5,0xaa,0x24,0x20,0xad} },
+    { {0xd5,0xaa,0x24,0x10,0xad},{0xd5,0xaa,0x24,0x30,0xad},{0xd5,0xaa,0x24,0x98,0xad},{0xd5,0xaa,0x24,0x98,0xad},{0xd5,0xaa,0x24,0x90,0xad},{0xd5,0xaa,0x24,0x91,0xad},{0xd5,0xaa,0x24,0x94,0xad},{0xd5,0xaa,0x24,0x94,0xad},{0xd5,0xaa,0x24,0x30,0xad} },
+    { {0xd5,0xaa,0x24,0x08,0xad},{0xd5,0xaa,0x24,0x28,0xad},{0xd5,0xaa,0x24,0x98,0xad},{0xd5,0xaa,0x24,0x88,0xad},{0xd5,0xaa,0x24,0x88,0xad},{0xd5,0xaa,0x24,0x99,0xad},{0xd5,0xaa,0x24,0x8c,0xad},{0xd5,0xaa,0x24,0x9c,0xad},{0xd5,0xaa,0x24,0x28,0xad} },
+    { {0xd5,0xaa,0x24,0x18,0xad},{0xd5,0xaa,0x24,0x38,0xad},{0xd5,0xaa,0x24,0x98,0xad},{0xd5,0xaa,0x24,0x98,0xad},{0xd5,0xaa,0x24,0x98,0xad},{0xd5,0xaa,0x24,0x99,0xad},{0xd5,0xaa,0x24,0x9c,0xad},{0xd5,0xaa,0x24,0x9c,0xad},{0xd5,0xaa,0x24,0x38,0xad} },
+    { {0xd5,0xaa,0x24,0x40,0xad},{0xd5,0xaa,0x24,0x60,0xad},{0xd5,0xaa,0x24,0xd8,0xad},{0xd5,0xaa,0x24,0xc8,0xad},{0xd5,0xaa,0x24,0xc0,0xad},{0xd5,0xaa,0x24,0xd1,0xad},{0xd5,0xaa,0x24,0xc4,0xad},{0xd5,0xaa,0x24,0xd4,0xad},{0xd5,0xaa,0x24,0x60,0xad} },
+    { {0xd5,0xaa,0x24,0x50,0xad},{0xd5,0xaa,0x24,0x70,0xad},{0xd5,0xaa,0x24,0xd8,0xad},{0xd5,0xaa,0x24,0xd8,0xad},{0xd5,0xaa,0x24,0xd0,0xad},{0xd5,0xaa,0x24,0xd1,0xad},{0xd5,0xaa,0x24,0xd4,0xad},{0xd5,0xaa,0x24,0xd4,0xad},{0xd5,0xaa,0x24,0x70,0xad} },
+    { {0xd5,0xaa,0x24,0x48,0xad},{0xd5,0xaa,0x24,0x68,0xad},{0xd5,0xaa,0x24,0xd8,0xad},{0xd5,0xaa,0x24,0xc8,0xad},{0xd5,0xaa,0x24,0xc8,0xad},{0xd5,0xaa,0x24,0xd9,0xad},{0xd5,0xaa,0x24,0xcc,0xad},{0xd5,0xaa,0x24,0xdc,0xad},{0xd5,0xaa,0x24,0x68,0xad} },
+    { {0xd5,0xaa,0x24,0x58,0xad},{0xd5,0xaa,0x24,0x78,0xad},{0xd5,0xaa,0x24,0xd8,0xad},{0xd5,0xaa,0x24,0xd8,0xad},{0xd5,0xaa,0x24,0xd8,0xad},{0xd5,0xaa,0x24,0xd9,0xad},{0xd5,0xaa,0x24,0xdc,0xad},{0xd5,0xaa,0x24,0xdc,0xad},{0xd5,0xaa,0x24,0x78,0xad} }
+  },
+  { /* P */
+    { {0xd5,0xaa,0x30,0x00,0xad},{0xd5,0xaa,0x30,0x20,0xad},{0xd5,0xaa,0x30,0x98,0xad},{0xd5,0xaa,0x30,0x88,0xad},{0xd5,0xaa,0x30,0x80,0xad},{0xd5,0xaa,0x30,0x91,0xad},{0xd5,0xaa,0x30,0x84,0xad},{0xd5,0xaa,0x30,0x94,0xad},{0xd5,0xaa,0x30,0x20,0xad} },
+    { {0xd5,0xaa,0x30,0x10,0xad},{0xd5,0xaa,0x30,0x30,0xad},{0xd5,0xaa,0x30,0x98,0xad},{0xd5,0xaa,0x30,0x98,0xad},{0xd5,0xaa,0x30,0x90,0xad},{0xd5,0xaa,0x30,0x91,0xad},{0xd5,0xaa,0x30,0x94,0xad},{0xd5,0xaa,0x30,0x94,0xad},{0xd5,0xaa,0x30,0x30,0xad} },
+    { {0xd5,0xaa,0x30,0x08,0xad},{0xd5,0xaa,0x30,0x28,0xad},{0xd5,0xaa,0x30,0x98,0xad},{0xd5,0xaa,0x30,0x88,0xad},{0xd5,0xaa,0x30,0x88,0xad},{0xd5,0xaa,0x30,0x99,0xad},{0xd5,0xaa,0x30,0x8c,0xad},{0xd5,0xaa,0x30,0x9c,0xad},{0xd5,0xaa,0x30,0x28,0xad} },
+    { {0xd5,0xaa,0x30,0x18,0xad},{0xd5,0xaa,0x30,0x38,0xad},{0xd5,0xaa,0x30,0x98,0xad},{0xd5,0xaa,0x30,0x98,0xad},{0xd5,0xaa,0x30,0x98,0xad},{0xd5,0xaa,0x30,0x99,0xad},{0xd5,0xaa,0x30,0x9c,0xad},{0xd5,0xaa,0x30,0x9c,0xad},{0xd5,0xaa,0x30,0x38,0xad} },
+    { {0xd5,0xaa,0x30,0x40,0xad},{0xd5,0xaa,0x30,0x60,0xad},{0xd5,0xaa,0x30,0xd8,0xad},{0xd5,0xaa,0x30,0xc8,0xad},{0xd5,0xaa,0x30,0xc0,0xad},{0xd5,0xaa,0x30,0xd1,0xad},{0xd5,0xaa,0x30,0xc4,0xad},{0xd5,0xaa,0x30,0xd4,0xad},{0xd5,0xaa,0x30,0x60,0xad} },
+    { {0xd5,0xaa,0x30,0x50,0xad},{0xd5,0xaa,0x30,0x70,0xad},{0xd5,0xaa,0x30,0xd8,0xad},{0xd5,0xaa,0x30,0xd8,0xad},{0xd5,0xaa,0x30,0xd0,0xad},{0xd5,0xaa,0x30,0xd1,0xad},{0xd5,0xaa,0x30,0xd4,0xad},{0xd5,0xaa,0x30,0xd4,0xad},{0xd5,0xaa,0x30,0x70,0xad} },
+    { {0xd5,0xaa,0x30,0x48,0xad},{0xd5,0xaa,0x30,0x68,0xad},{0xd5,0xaa,0x30,0xd8,0xad},{0xd5,0xaa,0x30,0xc8,0xad},{0xd5,0xaa,0x30,0xc8,0xad},{0xd5,0xaa,0x30,0xd9,0xad},{0xd5,0xaa,0x30,0xcc,0xad},{0xd5,0xaa,0x30,0xdc,0xad},{0xd5,0xaa,0x30,0x68,0xad} },
+    { {0xd5,0xaa,0x30,0x58,0xad},{0xd5,0xaa,0x30,0x78,0xad},{0xd5,0xaa,0x30,0xd8,0xad},{0xd5,0xaa,0x30,0xd8,0xad},{0xd5,0xaa,0x30,0xd8,0xad},{0xd5,0xaa,0x30,0xd9,0xad},{0xd5,0xaa,0x30,0xdc,0xad},{0xd5,0xaa,0x30,0xdc,0xad},{0xd5,0xaa,0x30,0x78,0xad} },
+    { {0xd5,0xaa,0x34,0x00,0xad},{0xd5,0xaa,0x34,0x20,0xad},{0xd5,0xaa,0x34,0x98,0xad},{0xd5,0xaa,0x34,0x88,0xad},{0xd5,0xaa,0x34,0x80,0xad},{0xd5,0xaa,0x34,0x91,0xad},{0xd5,0xaa,0x34,0x84,0xad},{0xd5,0xaa,0x34,0x94,0xad},{0xd5,0xaa,0x34,0x20,0xad} },
+    { {0xd5,0xaa,0x34,0x10,0xad},{0xd5,0xaa,0x34,0x30,0xad},{0xd5,0xaa,0x34,0x98,0xad},{0xd5,0xaa,0x34,0x98,0xad},{0xd5,0xaa,0x34,0x90,0xad},{0xd5,0xaa,0x34,0x91,0xad},{0xd5,0xaa,0x34,0x94,0xad},{0xd5,0xaa,0x34,0x94,0xad},{0xd5,0xaa,0x34,0x30,0xad} },
+    { {0xd5,0xaa,0x34,0x08,0xad},{0xd5,0xaa,0x34,0x28,0xad},{0xd5,0xaa,0x34,0x98,0xad},{0xd5,0xaa,0x34,0x88,0xad},{0xd5,0xaa,0x34,0x88,0xad},{0xd5,0xaa,0x34,0x99,0xad},{0xd5,0xaa,0x34,0x8c,0xad},{0xd5,0xaa,0x34,0x9c,0xad},{0xd5,0xaa,0x34,0x28,0xad} },
+    { {0xd5,0xaa,0x34,0x18,0xad},{0xd5,0xaa,0x34,0x38,0xad},{0xd5,0xaa,0x34,0x98,0xad},{0xd5,0xaa,0x34,0x98,0xad},{0xd5,0xaa,0x34,0x98,0xad},{0xd5,0xaa,0x34,0x99,0xad},{0xd5,0xaa,0x34,0x9c,0xad},{0xd5,0xaa,0x34,0x9c,0xad},{0xd5,0xaa,0x34,0x38,0xad} },
+    { {0xd5,0xaa,0x34,0x40,0xad},{0xd5,0xaa,0x34,0x60,0xad},{0xd5,0xaa,0x34,0xd8,0xad},{0xd5,0xaa,0x34,0xc8,0xad},{0xd5,0xaa,0x34,0xc0,0xad},{0xd5,0xaa,0x34,0xd1,0xad},{0xd5,0xaa,0x34,0xc4,0xad},{0xd5,0xaa,0x34,0xd4,0xad},{0xd5,0xaa,0x34,0x60,0xad} },
+    { {0xd5,0xaa,0x34,0x50,0xad},{0xd5,0xaa,0x34,0x70,0xad},{0xd5,0xaa,0x34,0xd8,0xad},{0xd5,0xaa,0x34,0xd8,0xad},{0xd5,0xaa,0x34,0xd0,0xad},{0xd5,0xaa,0x34,0xd1,0xad},{0xd5,0xaa,0x34,0xd4,0xad},{0xd5,0xaa,0x34,0xd4,0xad},{0xd5,0xaa,0x34,0x70,0xad} },
+    { {0xd5,0xaa,0x34,0x48,0xad},{0xd5,0xaa,0x34,0x68,0xad},{0xd5,0xaa,0x34,0xd8,0xad},{0xd5,0xaa,0x34,0xc8,0xad},{0xd5,0xaa,0x34,0xc8,0xad},{0xd5,0xaa,0x34,0xd9,0xad},{0xd5,0xaa,0x34,0xcc,0xad},{0xd5,0xaa,0x34,0xdc,0xad},{0xd5,0xaa,0x34,0x68,0xad} },
+    { {0xd5,0xaa,0x34,0x58,0xad},{0xd5,0xaa,0x34,0x78,0xad},{0xd5,0xaa,0x34,0xd8,0xad},{0xd5,0xaa,0x34,0xd8,0xad},{0xd5,0xaa,0x34,0xd8,0xad},{0xd5,0xaa,0x34,0xd9,0xad},{0xd5,0xaa,0x34,0xdc,0xad},{0xd5,0xaa,0x34,0xdc,0xad},{0xd5,0xaa,0x34,0x78,0xad} }
+  }
+};
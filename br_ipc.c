@@ -0,0 +1,555 @@
+/*
+ * br_ipc.c -- Passing command lists between br and the brd transmitter
+ *  daemon over a Unix-domain socket.
+ *  (c) 1999 by Tymm Twillman (tymm@acm.org).
+ *
+ * Everything goes over the wire as 32 bit big-endian words, except for
+ *  unit addresses, which are packed one per byte (housecode in the high
+ *  nybble, device in the low one, same as br_cmd() takes them).
+ *
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ */
+
+#ifdef __cplusplus
+extern C {
+#endif
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <unistd.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#endif
+
+#include "br_cmd.h"
+#include "br_cmd_engine.h"
+#include "br_ipc.h"
+
+
+static int write_full(int sock, void *buf, int len)
+{
+    char *p = buf;
+    int rv;
+
+
+    while (len > 0) {
+        if ((rv = write(sock, p, len)) < 0) {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+
+        p += rv;
+        len -= rv;
+    }
+
+    return 0;
+}
+
+static int read_full(int sock, void *buf, int len)
+{
+    char *p = buf;
+    int rv;
+
+
+    while (len > 0) {
+        if ((rv = read(sock, p, len)) < 0) {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+
+        if (rv == 0) {
+            errno = EPIPE;     /* other end went away mid-message */
+            return -1;
+        }
+
+        p += rv;
+        len -= rv;
+    }
+
+    return 0;
+}
+
+static int put_word(int sock, int val)
+{
+    unsigned char buf[4];
+
+
+    buf[0] = ((unsigned long)val >> 24) & 0xff;
+    buf[1] = ((unsigned long)val >> 16) & 0xff;
+    buf[2] = ((unsigned long)val >> 8) & 0xff;
+    buf[3] = (unsigned long)val & 0xff;
+
+    return write_full(sock, buf, 4);
+}
+
+static int get_word(int sock, int *val)
+{
+    unsigned char buf[4];
+
+
+    if (read_full(sock, buf, 4) < 0)
+        return -1;
+
+    *val = (int)(((unsigned long)buf[0] << 24) | ((unsigned long)buf[1] << 16)
+      | ((unsigned long)buf[2] << 8) | (unsigned long)buf[3]);
+
+    return 0;
+}
+
+static int make_addr(char *path, struct sockaddr_un *addr)
+{
+    if (strlen(path) >= sizeof(addr->sun_path)) {
+        errno = ENAMETOOLONG;
+        return -1;
+    }
+
+    memset(addr, 0, sizeof(*addr));
+    addr->sun_family = AF_UNIX;
+    strcpy(addr->sun_path, path);
+
+    return 0;
+}
+
+static int socket_dir(char *path, char *dir)
+{
+    /*
+     * dir gets the directory path's in (dir has to be as big as path)
+     */
+
+    char *slash;
+
+
+    strcpy(dir, path);
+
+    if ((slash = strrchr(dir, '/')) == NULL)
+        strcpy(dir, ".");
+    else if (slash == dir)
+        dir[1] = '\0';
+    else
+        *slash = '\0';
+
+    return 0;
+}
+
+static int safe_socket(char *path, uid_t owner, struct stat *sb)
+{
+    /*
+     * Whether the socket at path can be trusted: it's in a directory
+     *  nobody but its owner can write to, and it belongs to owner (or
+     *  whoever owns the directory, if owner is -1), or to root.  *sb
+     *  gets the socket's lstat(); errno says what was wrong if it isn't
+     *  safe.
+     */
+
+    struct sockaddr_un addr;
+    struct stat dsb;
+    char dir[sizeof(addr.sun_path)];
+
+
+    socket_dir(path, dir);
+
+    if (lstat(dir, &dsb) < 0)
+        return 0;
+
+    if (!S_ISDIR(dsb.st_mode) || (dsb.st_mode & (S_IWGRP | S_IWOTH))) {
+        errno = EPERM;
+        return 0;
+    }
+
+    if (owner == (uid_t)-1)
+        owner = dsb.st_uid;
+
+    if (lstat(path, sb) < 0)
+        return 0;
+
+    if (!S_ISSOCK(sb->st_mode)
+      || ((sb->st_uid != owner) && (sb->st_uid != 0)))
+    {
+        errno = EPERM;
+        return 0;
+    }
+
+    return 1;
+}
+
+int br_daemon_connect(char *path)
+{
+/*
+ * Try to get hold of a running brd.  Failure here is normal (no daemon
+ *  running) so it's left to the caller to decide whether to complain.
+ *  A socket that anybody could have put there doesn't count as a
+ *  daemon; commands would be going to who knows what.
+ */
+
+    struct sockaddr_un addr;
+    struct stat sb;
+    int sock;
+    int tmperrno;
+
+
+    if (make_addr(path, &addr) < 0)
+        return -1;
+
+    if (!safe_socket(path, (uid_t)-1, &sb))
+        return -1;
+
+    if ((sock = socket(AF_UNIX, SOCK_STREAM, 0)) < 0)
+        return -1;
+
+    if (connect(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        tmperrno = errno;
+        close(sock);
+        errno = tmperrno;
+        return -1;
+    }
+
+    return sock;
+}
+
+int br_daemon_listen(char *path)
+{
+/*
+ * Set up the socket brd takes commands on.  Its directory is made if
+ *  need be, and has to be ours (or root's) with nobody else able to
+ *  write to it; the socket itself is only open to us and our group.
+ */
+
+    struct sockaddr_un addr;
+    struct stat sb;
+    char dir[sizeof(addr.sun_path)];
+    mode_t oldmask;
+    int sock = -1;
+    int tmpsock = -1;
+    int tmperrno;
+
+
+    if (make_addr(path, &addr) < 0) {
+        br_error("br_daemon_listen", "Socket path too long");
+        return -1;
+    }
+
+    oldmask = umask(007);
+
+    socket_dir(path, dir);
+
+    if ((mkdir(dir, 0750) < 0) && (errno != EEXIST)) {
+        br_error("br_daemon_listen", "Unable to make socket directory");
+        goto fail;
+    }
+
+    if (lstat(dir, &sb) < 0) {
+        br_error("br_daemon_listen", "Unable to check socket directory");
+        goto fail;
+    }
+
+    if (!S_ISDIR(sb.st_mode) || (sb.st_mode & (S_IWGRP | S_IWOTH))
+      || ((sb.st_uid != geteuid()) && (sb.st_uid != 0)))
+    {
+        errno = EPERM;
+        br_error("br_daemon_listen", "Socket directory isn't safe to use");
+        goto fail;
+    }
+
+    if ((sock = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) {
+        br_error("br_daemon_listen", "socket");
+        goto fail;
+    }
+
+    /*
+     * A stale socket left behind by a daemon that died would keep us
+     *  from binding; if it's one of ours and nobody answers on it, it's
+     *  safe to get rid of.  Anything else there is left alone.
+     */
+
+    if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        if ((errno != EADDRINUSE) || !safe_socket(path, geteuid(), &sb)
+          || ((tmpsock = br_daemon_connect(path)) >= 0)
+          || (errno != ECONNREFUSED))
+        {
+            if (tmpsock >= 0)
+                close(tmpsock);
+            errno = EADDRINUSE;
+            br_error("br_daemon_listen", "Socket in use (already running?)");
+            goto fail;
+        }
+
+        unlink(path);
+
+        if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+            br_error("br_daemon_listen", "bind");
+            goto fail;
+        }
+    }
+
+    if (chmod(path, 0660) < 0) {
+        br_error("br_daemon_listen", "chmod");
+        unlink(path);
+        goto fail;
+    }
+
+    if (listen(sock, 16) < 0) {
+        br_error("br_daemon_listen", "listen");
+        unlink(path);
+        goto fail;
+    }
+
+    umask(oldmask);
+
+    return sock;
+
+fail:
+    tmperrno = errno;
+
+    if (sock >= 0)
+        close(sock);
+
+    umask(oldmask);
+    errno = tmperrno;
+
+    return -1;
+}
+
+int br_send_control_info(int sock, br_control_info *cinfo)
+{
+    unsigned char unitbuf[BR_IPC_MAXUNITS];
+    register int i;
+    register int j;
+    int u;
+    int numunits;
+
+
+    if (cinfo == NULL) {
+        errno = EINVAL;
+        br_error("br_send_control_info", "NULL control info pointer");
+        return -1;
+    }
+
+    if ((put_word(sock, BR_IPC_MAGIC) < 0)
+      || (put_word(sock, cinfo->inverse) < 0)
+      || (put_word(sock, cinfo->repeat) < 0)
+      || (put_word(sock, cinfo->stream) < 0)
+      || (put_word(sock, cinfo->priority) < 0))
+    {
+        br_error("br_send_control_info", "write");
+        return -1;
+    }
+
+    for (i = 0; i < BR_NUM_CMDS; i++) {
+        if (put_word(sock, cinfo->retx.copies[i]) < 0) {
+            br_error("br_send_control_info", "write");
+            return -1;
+        }
+    }
+
+    if ((put_word(sock, cinfo->retx.spread) < 0)
+      || (put_word(sock, cinfo->gap) < 0)
+      || (put_word(sock, cinfo->numcmds) < 0))
+    {
+        br_error("br_send_control_info", "write");
+        return -1;
+    }
+
+    for (i = 0; i < cinfo->numcmds; i++) {
+        numunits = br_get_num_units(cinfo->units[i]);
+
+        if (numunits > BR_IPC_MAXUNITS) {
+            errno = E2BIG;
+            br_error("br_send_control_info", "Too many units for one command");
+            return -1;
+        }
+
+        /*
+         * In the order they go out, so the far end's list sends the same
+         *  unit last in each housecode
+         */
+
+        for (j = 0, u = br_ul_next(cinfo->units[i], -1); u >= 0;
+          u = br_ul_next(cinfo->units[i], u))
+            unitbuf[j++] = u;
+
+        if ((put_word(sock, cinfo->cmds[i]) < 0)
+          || (put_word(sock, numunits) < 0)
+          || (write_full(sock, unitbuf, numunits) < 0))
+        {
+            br_error("br_send_control_info", "write");
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+br_control_info *br_recv_control_info(int sock)
+{
+    br_control_info *cinfo;
+    br_unit_list *units;
+    unsigned char unitbuf[BR_IPC_MAXUNITS];
+    register int i;
+    register int j;
+    int magic;
+    int copies;
+    int spread;
+    int numcmds;
+    int numunits;
+    int cmd;
+
+
+    if ((get_word(sock, &magic) < 0) || (magic != BR_IPC_MAGIC)) {
+        errno = EPROTO;
+        br_error("br_recv_control_info", "Bad message header");
+        return NULL;
+    }
+
+    if ((cinfo = br_new_control_info()) == NULL)
+        return NULL;
+
+    if ((get_word(sock, &cinfo->inverse) < 0)
+      || (get_word(sock, &cinfo->repeat) < 0)
+      || (get_word(sock, &cinfo->stream) < 0)
+      || (get_word(sock, &cinfo->priority) < 0))
+    {
+        br_error("br_recv_control_info", "read");
+        goto fail;
+    }
+
+    for (i = 0; i < BR_NUM_CMDS; i++) {
+        if (get_word(sock, &copies) < 0) {
+            br_error("br_recv_control_info", "read");
+            goto fail;
+        }
+
+        if (br_set_copies(cinfo, i, copies) < 0)
+            goto fail;
+    }
+
+    if (get_word(sock, &spread) < 0) {
+        br_error("br_recv_control_info", "read");
+        goto fail;
+    }
+
+    if (br_set_spread(cinfo, spread) < 0)
+        goto fail;
+
+    if ((get_word(sock, &cinfo->gap) < 0)
+      || (get_word(sock, &numcmds) < 0))
+    {
+        br_error("br_recv_control_info", "read");
+        goto fail;
+    }
+
+    if ((numcmds < 0) || (numcmds > BR_IPC_MAXCMDS) || (cinfo->repeat < 0)
+      || (cinfo->priority < 0) || (cinfo->priority >= BR_NUM_PRIS)
+      || (cinfo->gap < -1))
+    {
+        errno = EPROTO;
+        br_error("br_recv_control_info", "Bad command count, priority or gap");
+        goto fail;
+    }
+
+    for (i = 0; i < numcmds; i++) {
+        if ((get_word(sock, &cmd) < 0) || (get_word(sock, &numunits) < 0)) {
+            br_error("br_recv_control_info", "read");
+            goto fail;
+        }
+
+        if ((cmd < ON) || (cmd > PAUSE)
+          || (numunits < 0) || (numunits > BR_IPC_MAXUNITS))
+        {
+            errno = EPROTO;
+            br_error("br_recv_control_info", "Bad command");
+            goto fail;
+        }
+
+        if (read_full(sock, unitbuf, numunits) < 0) {
+            br_error("br_recv_control_info", "read");
+            goto fail;
+        }
+
+        /*
+         * Built right in the control info's arena; no copying
+         */
+
+        if ((units = br_new_cmd_unit_list(cinfo)) == NULL)
+            goto fail;
+
+        for (j = 0; j < numunits; j++) {
+            if (br_add_unit(units, unitbuf[j] >> 4, unitbuf[j] & 0x0f) < 0)
+                goto fail;
+        }
+
+        if (br_add_ul_cmd_take(cinfo, cmd, units) < 0)
+            goto fail;
+    }
+
+    return cinfo;
+
+fail:
+    br_free_control_info(cinfo);
+
+    return NULL;
+}
+
+int br_send_status(int sock, int status, int err)
+{
+    if ((put_word(sock, BR_IPC_STATUS) < 0)
+      || (put_word(sock, status) < 0)
+      || (put_word(sock, err) < 0))
+    {
+        br_error("br_send_status", "write");
+        return -1;
+    }
+
+    return 0;
+}
+
+int br_recv_status(int sock, int *status, int *err)
+{
+/*
+ * Fills in the status the daemon sent back (0 or -1), and the daemon's
+ *  errno if it failed; returns -1 if the reply itself didn't make it.
+ */
+
+    int magic;
+
+
+    if ((get_word(sock, &magic) < 0)
+      || ((magic != BR_IPC_STATUS) && ((errno = EPROTO) != 0))
+      || (get_word(sock, status) < 0) || (get_word(sock, err) < 0))
+    {
+        br_error("br_recv_status", "Lost contact with brd");
+        return -1;
+    }
+
+    return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
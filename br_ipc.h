@@ -0,0 +1,60 @@
+#ifndef _BR_IPC_H
+#define _BR_IPC_H
+
+/*
+ * br_ipc.h -- Passing command lists between br and the brd transmitter
+ *             daemon over a Unix-domain socket.
+ *
+ * (c) 1999 Tymm Twillman (tymm@acm.org)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "br_cmd_engine.h"
+
+/*
+ * Where brd listens if nobody says otherwise (can be overridden with
+ *  the BRD_SOCKNAME environment variable).  The directory belongs to
+ *  whoever runs brd, and only it (and its group) can get in; brd makes
+ *  it if it isn't there.
+ */
+
+#ifndef BRD_SOCKNAME
+#define BRD_SOCKNAME "/run/br/brd.socket"
+#endif
+
+/*
+ * A command list goes over as BR_IPC_MAGIC, then inverse, repeat,
+ *  stream, priority, the copies for each command, spread, gap and the
+ *  number of commands, then each command with its count of units and
+ *  the units themselves (a byte each); all the rest are 32-bit words,
+ *  most significant byte first
+ */
+
+#define BR_IPC_MAGIC     0x42524331   /* "BRC1" -- command list */
+#define BR_IPC_STATUS    0x42525331   /* "BRS1" -- execution status */
+
+#define BR_IPC_MAXCMDS   65536        /* sanity limits on what we'll accept */
+#define BR_IPC_MAXUNITS  256
+
+int br_daemon_connect(char * /* socket path */);
+int br_daemon_listen(char * /* socket path */);
+int br_send_control_info(int /* socket */, br_control_info *);
+br_control_info *br_recv_control_info(int /* socket */);
+int br_send_status(int /* socket */, int /* status */, int /* errno */);
+int br_recv_status(int /* socket */, int * /* status */, int * /* errno */);
+
+#endif
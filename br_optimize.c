@@ -0,0 +1,340 @@
+/*
+ * br_optimize.c -- Squeeze redundant commands out of a BottleRocket
+ *  command list before it goes out; every frame costs most of a second
+ *  of airtime, so it's worth not sending ones that don't change anything.
+ *  (c) 1999 by Tymm Twillman (tymm@acm.org).
+ *
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ */
+
+#ifdef __cplusplus
+extern C {
+#endif
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#endif
+
+#include "br_cmd.h"
+#include "br_cmd_engine.h"
+
+
+/*
+ * One frame's worth of a command list
+ */
+
+typedef struct {
+    int cmd;
+    int house;
+    int dev;
+} opt_frame;
+
+static int count_frames(br_control_info *cinfo, long *usecs)
+{
+    register int i;
+    int n;
+    int frames = 0;
+
+
+    *usecs = 0;
+
+    for (i = 0; i < cinfo->numcmds; i++) {
+        n = CMDHASDEVS(cinfo->cmds[i]) ? br_get_num_units(cinfo->units[i]):1;
+        frames += n;
+        *usecs += n * br_cmd_usecs(cinfo->cmds[i]);
+    }
+
+    return frames;
+}
+
+static int flatten(br_control_info *cinfo, opt_frame *frames)
+{
+    register int i;
+    int u;
+    int n = 0;
+
+
+    for (i = 0; i < cinfo->numcmds; i++) {
+        if (CMDHASDEVS(cinfo->cmds[i])) {
+            for (u = br_ul_next(cinfo->units[i], -1); u >= 0;
+              u = br_ul_next(cinfo->units[i], u))
+            {
+                frames[n].cmd = cinfo->cmds[i];
+                frames[n].house = BR_UNIT_HOUSE(u);
+                frames[n].dev = BR_UNIT_DEV(u);
+                n++;
+            }
+        } else {
+            frames[n].cmd = cinfo->cmds[i];
+            frames[n].house = br_get_ul_house(cinfo->units[i], 0);
+            frames[n].dev = 0;
+            n++;
+        }
+    }
+
+    return n;
+}
+
+static int squeeze(opt_frame *in, int n, opt_frame *out)
+{
+/*
+ * The actual optimizing.  The list is taken a run at a time:
+ *
+ *  - a run of ON/OFF commands only needs the last command given to each
+ *    unit in it.  Only earlier copies are dropped, so whatever unit was
+ *    addressed last in each housecode stays last, and DIM/BRIGHT after
+ *    the run still goes to the right place.
+ *  - a run of DIM/BRIGHT commands is netted out per housecode (this
+ *    ignores the ends of the dim range, as relative dimming always has).
+ *  - everything else goes out as-is, except that a group command
+ *    immediately repeating the one before it is dropped.
+ */
+
+    char last[256];
+    int net[16];
+    int seen[16];
+    int order[16];
+    int norder;
+    register int i;
+    register int j;
+    register int k;
+    int unit;
+    int m = 0;
+
+
+    i = 0;
+
+    while (i < n) {
+        if (CMDHASDEVS(in[i].cmd)) {
+            for (j = i; (j < n) && CMDHASDEVS(in[j].cmd); j++)
+                ;
+
+            /*
+             * Walk backwards so the first time we see a unit is the copy
+             *  that counts; mark which ones survive, then copy forward.
+             */
+
+            memset(last, 0, sizeof(last));
+
+            for (k = j - 1; k >= i; k--) {
+                unit = (in[k].house << 4) | in[k].dev;
+
+                if (last[unit])
+                    in[k].cmd = -1;
+                else
+                    last[unit] = 1;
+            }
+
+            for (k = i; k < j; k++) {
+                if (in[k].cmd >= 0)
+                    out[m++] = in[k];
+            }
+
+            i = j;
+        } else if (ISDIMCMD(in[i].cmd)) {
+            memset(net, 0, sizeof(net));
+            memset(seen, 0, sizeof(seen));
+            norder = 0;
+
+            for (j = i; (j < n) && ISDIMCMD(in[j].cmd); j++) {
+                if (!seen[in[j].house]) {
+                    seen[in[j].house] = 1;
+                    order[norder++] = in[j].house;
+                }
+
+                net[in[j].house] += (in[j].cmd == BRIGHT) ? 1:-1;
+            }
+
+            for (k = 0; k < norder; k++) {
+                for (unit = 0; unit < abs(net[order[k]]); unit++) {
+                    out[m].cmd = (net[order[k]] > 0) ? BRIGHT:DIM;
+                    out[m].house = order[k];
+                    out[m].dev = 0;
+                    m++;
+                }
+            }
+
+            i = j;
+        } else {
+            if ((in[i].cmd == PAUSE) || (m == 0)
+              || (out[m - 1].cmd != in[i].cmd)
+              || (out[m - 1].house != in[i].house))
+            {
+                out[m++] = in[i];
+            }
+
+            i++;
+        }
+    }
+
+    return m;
+}
+
+static int rebuild(br_control_info *cinfo, opt_frame *frames, int n)
+{
+/*
+ * Turn the frames back into a command list, putting neighboring ON or
+ *  OFF frames back into one unit list.
+ */
+
+    br_control_info *tmp;
+    br_unit_list *units;
+    br_arena *arena;
+    register int i;
+    register int j;
+    int tmperrno;
+
+
+    if ((tmp = br_new_control_info()) == NULL)
+        return -1;
+
+    if ((units = br_new_unit_list()) == NULL) {
+        br_free_control_info(tmp);
+        return -1;
+    }
+
+    for (i = 0; i < n; i = j) {
+        if (CMDHASDEVS(frames[i].cmd)) {
+            br_del_unit(units, 0, 0);
+
+            for (j = i; (j < n) && (frames[j].cmd == frames[i].cmd); j++) {
+                if (br_add_unit(units, frames[j].house, frames[j].dev) < 0)
+                    goto fail;
+            }
+
+            if (br_add_ul_cmd(tmp, frames[i].cmd, units) < 0)
+                goto fail;
+        } else {
+            if (br_add_cmd(tmp, frames[i].cmd, frames[i].house, 0) < 0)
+                goto fail;
+
+            j = i + 1;
+        }
+    }
+
+    br_free_unit_list(units);
+    br_free_cmds(cinfo);
+
+    /*
+     * The new lists live in tmp's arena, so that comes along too, and
+     *  tmp goes away with cinfo's old (now empty) one
+     */
+
+    arena = cinfo->arena;
+
+    cinfo->cmds = tmp->cmds;
+    cinfo->units = tmp->units;
+    cinfo->numcmds = tmp->numcmds;
+    cinfo->allocatedcmds = tmp->allocatedcmds;
+    cinfo->heaplists = tmp->heaplists;
+    cinfo->arena = tmp->arena;
+
+    tmp->cmds = NULL;
+    tmp->units = NULL;
+    tmp->numcmds = 0;
+    tmp->heaplists = 0;
+    tmp->arena = arena;
+    br_free_control_info(tmp);
+
+    return 0;
+
+fail:
+    tmperrno = errno;
+    br_free_unit_list(units);
+    br_free_control_info(tmp);
+    errno = tmperrno;
+
+    return -1;
+}
+
+int br_optimize(br_control_info *cinfo, br_opt_stats *stats)
+{
+/*
+ * Rewrite a command list into the shortest one with the same end
+ *  result.  The list is left alone if anything goes wrong.  If stats
+ *  isn't NULL, it gets filled in with what was saved (per pass through
+ *  the list; multiply by cinfo->repeat for the whole thing).
+ */
+
+    opt_frame *in;
+    opt_frame *out;
+    int before;
+    int after;
+    long usecs_before;
+    long usecs_after;
+
+
+    if (cinfo == NULL) {
+        errno = EINVAL;
+        br_error("br_optimize", "NULL control info pointer");
+        return -1;
+    }
+
+    before = count_frames(cinfo, &usecs_before);
+
+    if (before == 0) {
+        if (stats) {
+            stats->frames_before = stats->frames_after = 0;
+            stats->usecs_saved = 0;
+        }
+        return 0;
+    }
+
+    in = malloc(sizeof(opt_frame) * before);
+    out = malloc(sizeof(opt_frame) * before);
+
+    if ((in == NULL) || (out == NULL)) {
+        br_error("br_optimize", "malloc");
+        free(in);
+        free(out);
+        return -1;
+    }
+
+    after = squeeze(in, flatten(cinfo, in), out);
+
+    if ((after < before) && (rebuild(cinfo, out, after) < 0)) {
+        free(in);
+        free(out);
+        return -1;
+    }
+
+    free(in);
+    free(out);
+
+    after = count_frames(cinfo, &usecs_after);
+
+    if (stats) {
+        stats->frames_before = before;
+        stats->frames_after = after;
+        stats->usecs_saved = usecs_before - usecs_after;
+    }
+
+    return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
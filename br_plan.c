@@ -0,0 +1,792 @@
+/*
+ * br_plan.c -- Compiling BottleRocket command lists into flat arrays of
+ *  ready-to-send frames, and walking through them.
+ *  (c) 1999 by Tymm Twillman (tymm@acm.org).
+ *
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ */
+
+#ifdef __cplusplus
+extern C {
+#endif
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <unistd.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#endif
+
+#include "br_cmd.h"
+#include "br_cmd_engine.h"
+#include "br_plan.h"
+
+
+int br_make_frame(br_frame *frame, unsigned char unit, int cmd)
+{
+    if ((cmd < 0) || (cmd > PAUSE)) {
+        errno = EINVAL;
+        br_error("br_make_frame", "Invalid command");
+        return -1;
+    }
+
+    /*
+     * Make sure to set the numeric part of the device address to 0
+     *  for dim/bright (they only work per housecode)
+     */
+
+    if (ISDIMCMD(cmd))
+        unit &= 0xf0;
+
+    memcpy(frame->bytes, BR_FRAME_BYTES(unit, cmd), BR_FRAME_LEN);
+    frame->unit = unit;
+    frame->cmd = cmd;
+
+    return 0;
+}
+
+static int fill_frames(br_control_info *cinfo, br_frame *frames)
+{
+/*
+ * One frame per unit per command, in order
+ */
+
+    register int i;
+    int n;
+    int u;
+    unsigned char unit;
+
+
+    for (n = 0, i = 0; i < cinfo->numcmds; i++) {
+        if (!CMDHASDEVS(cinfo->cmds[i])) {
+
+            /*
+             * Just the housecode (of the first unit) matters
+             */
+
+            unit = BR_UNIT(br_get_ul_house(cinfo->units[i], 0), 0);
+
+            if (br_make_frame(&frames[n++], unit, cinfo->cmds[i]) < 0)
+                return -1;
+
+            continue;
+        }
+
+        for (u = br_ul_next(cinfo->units[i], -1); u >= 0;
+          u = br_ul_next(cinfo->units[i], u))
+        {
+            if (br_make_frame(&frames[n++], u, cinfo->cmds[i]) < 0)
+                return -1;
+        }
+    }
+
+    return n;
+}
+
+static int copies_of(br_control_info *cinfo, int cmd)
+{
+    if (ISDIMCMD(cmd) || (cmd == PAUSE) || (cinfo->retx.copies[cmd] < 1))
+        return 1;
+
+    return cinfo->retx.copies[cmd];
+}
+
+static int must_precede(const br_frame *copy, const br_frame *next,
+  int anchor)
+{
+/*
+ * Does a copy still waiting to go out have to go before next?  It does
+ *  if next is a pause, or if it's on the same housecode and either might
+ *  undo the other (same unit, or a command for the whole housecode), or
+ *  if sending the copy after next would change which unit a dim goes to
+ *  (next is a dim, or the last unit addressed before one: anchor).
+ */
+
+    if (next->cmd == PAUSE)
+        return 1;
+
+    if (BR_UNIT_HOUSE(copy->unit) != BR_UNIT_HOUSE(next->unit))
+        return 0;
+
+    return anchor || ISDIMCMD(next->cmd) || !CMDHASDEVS(copy->cmd)
+      || !CMDHASDEVS(next->cmd) || (copy->unit == next->unit);
+}
+
+static int interleave(br_control_info *cinfo, br_frame *orig, int n,
+  br_frame *out)
+{
+/*
+ * Lay out the copies: the kth copy of a frame goes out before k * spread
+ *  more of the original frames have, as well as anything it must
+ *  precede.  A copy that's still waiting when an identical original
+ *  comes along is dropped, since that does the job.  Returns how many
+ *  frames there are now.
+ */
+
+    struct pending {
+        br_frame frame;
+        int due;                /* go before original frame due */
+    } *pending;
+    char *anchor;
+    int lastdim[16];
+    int numpending = 0;
+    int numout = 0;
+    int first;
+    int max = 0;
+    int h;
+    register int i;
+    register int j;
+    int k;
+
+
+    for (i = 0; i < BR_NUM_CMDS; i++) {
+        if (copies_of(cinfo, i) > max)
+            max = copies_of(cinfo, i);
+    }
+
+    pending = malloc(n * (max - 1) * sizeof(*pending) + n);
+
+    if (pending == NULL) {
+        br_error("br_compile", "malloc");
+        return -1;
+    }
+
+#ifdef MEM_DEBUG
+    printf("br_compile: Malloced %d bytes at %lx\n",
+      n * (max - 1) * sizeof(*pending) + n, (unsigned long)pending);
+#endif
+
+    anchor = (char *)(pending + n * (max - 1));
+
+    /*
+     * Which frames are the last unit addressed before a dim
+     */
+
+    for (h = 0; h < 16; h++)
+        lastdim[h] = 0;
+
+    for (i = n - 1; i >= 0; i--) {
+        h = BR_UNIT_HOUSE(orig[i].unit);
+        anchor[i] = 0;
+
+        if (ISDIMCMD(orig[i].cmd))
+            lastdim[h] = 1;
+        else if (CMDHASDEVS(orig[i].cmd)) {
+            anchor[i] = lastdim[h];
+            lastdim[h] = 0;
+        } else if (orig[i].cmd != PAUSE)
+            lastdim[h] = 0;
+    }
+
+    for (i = 0; i < n; i++) {
+
+        /*
+         * Copies that are due, soonest first
+         */
+
+        for (;;) {
+            for (first = -1, j = 0; j < numpending; j++) {
+                if ((pending[j].due <= i)
+                  && ((first < 0) || (pending[j].due < pending[first].due)))
+                    first = j;
+            }
+
+            if (first < 0)
+                break;
+
+            out[numout++] = pending[first].frame;
+            memmove(&pending[first], &pending[first + 1],
+              (numpending - first - 1) * sizeof(*pending));
+            numpending--;
+        }
+
+        /*
+         * Copies that can't wait for this one
+         */
+
+        for (j = 0; j < numpending; ) {
+            if ((pending[j].frame.unit == orig[i].unit)
+              && (pending[j].frame.cmd == orig[i].cmd))
+                ;
+            else if (must_precede(&pending[j].frame, &orig[i], anchor[i]))
+                out[numout++] = pending[j].frame;
+            else {
+                j++;
+                continue;
+            }
+
+            memmove(&pending[j], &pending[j + 1],
+              (numpending - j - 1) * sizeof(*pending));
+            numpending--;
+        }
+
+        out[numout++] = orig[i];
+
+        for (k = 1; k < copies_of(cinfo, orig[i].cmd); k++) {
+            pending[numpending].frame = orig[i];
+            pending[numpending].due = i + 1 + k * cinfo->retx.spread;
+            numpending++;
+        }
+    }
+
+    /*
+     * Whatever's left goes on the end, in order
+     */
+
+    for (j = 0; j < numpending; j++)
+        out[numout++] = pending[j].frame;
+
+#ifdef MEM_DEBUG
+    printf("br_compile: Freeing memory at %lx\n", (unsigned long)pending);
+#endif
+
+    free(pending);
+
+    return numout;
+}
+
+br_plan *br_compile(br_control_info *cinfo)
+{
+/*
+ * Flatten a command list into one frame per unit per command, so that
+ *  nothing needs to be looked up or worked out while transmitting.
+ *  Copies (cinfo->retx) are laid out here too, each close behind its
+ *  original; repeats and inverted passes aren't stored, since
+ *  br_plan_next() works those out as it goes.
+ */
+
+    br_plan *plan;
+    br_frame *orig;
+    register int i;
+    int numframes = 0;
+    int maxframes = 0;
+    int n;
+
+
+    if (cinfo == NULL) {
+        errno = EINVAL;
+        br_error("br_compile", "NULL control info pointer");
+        return NULL;
+    }
+
+    if ((cinfo->units == NULL) && cinfo->numcmds) {
+        errno = EINVAL;
+        br_error("br_compile", "NULL unit list pointer");
+        return NULL;
+    }
+
+    for (i = 0; i < cinfo->numcmds; i++) {
+        if (CMDHASDEVS(cinfo->cmds[i])
+          && (br_get_num_units(cinfo->units[i]) == 0))
+        {
+            errno = EINVAL;
+            br_error("br_compile", "Empty device list");
+            return NULL;
+        }
+
+        n = CMDHASDEVS(cinfo->cmds[i]) ? br_get_num_units(cinfo->units[i]):1;
+        numframes += n;
+        maxframes += n * copies_of(cinfo, cinfo->cmds[i]);
+    }
+
+    /*
+     * Plan and frames in one block; one malloc, one free.  With copies,
+     *  the frames go in after the originals (and room to lay them out).
+     */
+
+    n = (maxframes > numframes) ? maxframes + numframes:numframes;
+    plan = malloc(sizeof(br_plan) + n * sizeof(br_frame));
+
+    if (plan == NULL) {
+        br_error("br_compile", "malloc");
+        return NULL;
+    }
+
+#ifdef MEM_DEBUG
+    printf("br_compile: Malloced %d bytes at %lx\n",
+      sizeof(br_plan) + n * sizeof(br_frame), (unsigned long)plan);
+#endif
+
+    plan->inverse = cinfo->inverse;
+    plan->repeat = cinfo->repeat;
+    plan->stream = cinfo->stream;
+    plan->gap = (cinfo->gap >= 0) ? cinfo->gap:BR_CTX->inter_frame_delay;
+    plan->numframes = numframes;
+    plan->frames = (br_frame *)(plan + 1);
+    plan->map = NULL;
+    plan->maplen = 0;
+
+    orig = (maxframes > numframes) ? plan->frames + maxframes:plan->frames;
+
+    if (fill_frames(cinfo, orig) < 0) {
+        br_free_plan(plan);
+        return NULL;
+    }
+
+    if ((maxframes > numframes) && ((plan->numframes = interleave(cinfo,
+      orig, numframes, plan->frames)) < 0))
+    {
+        br_free_plan(plan);
+        return NULL;
+    }
+
+    return plan;
+}
+
+int br_free_plan(br_plan *plan)
+{
+    if (plan == NULL)
+        return 0;
+
+    if (plan->map)
+        munmap(plan->map, plan->maplen);
+
+#ifdef MEM_DEBUG
+    printf("br_free_plan: Freeing memory at %lx\n", (unsigned long)plan);
+#endif
+
+    free(plan);
+
+    return 0;
+}
+
+void br_plan_iter_init(br_plan_iter *iter, br_plan *plan)
+{
+    iter->plan = plan;
+    iter->index = 0;
+    iter->pass = 0;
+    iter->inverse = plan->inverse;
+}
+
+const br_frame *br_plan_next(br_plan_iter *iter)
+{
+/*
+ * Hand out the next frame to send, or NULL when there aren't any more.
+ *  Same rules as always: with inverse set, every other pass through the
+ *  list goes out with each command turned around.
+ */
+
+    br_plan *plan = iter->plan;
+    const br_frame *frame;
+
+
+    if ((plan->numframes == 0) || (iter->pass >= plan->repeat))
+        return NULL;
+
+    if (iter->index >= plan->numframes) {
+        if (++iter->pass >= plan->repeat)
+            return NULL;
+
+        iter->index = 0;
+
+        if (iter->inverse)
+            iter->inverse = 0 - iter->inverse;
+    }
+
+    frame = &plan->frames[iter->index++];
+
+    if ((iter->inverse < 0) && (frame->cmd != PAUSE)) {
+        if (br_make_frame(&iter->scratch, frame->unit,
+          br_inverse_cmd(frame->cmd)) < 0)
+            return NULL;
+
+        return &iter->scratch;
+    }
+
+    return frame;
+}
+
+int br_execute_plan(int fd, br_plan *plan)
+{
+    br_plan_iter iter;
+    const br_frame *frame;
+    long oldgap;
+    int tmperrno;
+    int rv;
+
+
+    if (plan == NULL) {
+        errno = EINVAL;
+        br_error("br_execute_plan", "NULL plan pointer");
+        return -1;
+    }
+
+    /*
+     * In streaming mode the lines stay in "clock" position from the first
+     *  frame to the last, with just one short gap between frames (the
+     *  plan's own, if it has one).
+     */
+
+    oldgap = br_stream_gap(plan->gap);
+
+    if (plan->stream && (br_stream_begin(fd) < 0)) {
+        br_stream_gap(oldgap);
+        return -1;
+    }
+
+    br_plan_iter_init(&iter, plan);
+
+    while ((frame = br_plan_next(&iter)) != NULL) {
+        if (br_send_frame(fd, frame) < 0) {
+            tmperrno = errno;
+
+            if (plan->stream)
+                br_stream_end(fd);
+
+            br_stream_gap(oldgap);
+            errno = tmperrno;
+
+            return -1;
+        }
+    }
+
+    rv = plan->stream ? br_stream_end(fd):0;
+
+    br_stream_gap(oldgap);
+
+    return rv;
+}
+
+static uint32_t adler32(const unsigned char *buf, size_t len)
+{
+    uint32_t a = 1;
+    uint32_t b = 0;
+
+
+    while (len--) {
+        a = (a + *buf++) % 65521;
+        b = (b + a) % 65521;
+    }
+
+    return (b << 16) | a;
+}
+
+static int write_out(int fd, const void *buf, size_t len)
+{
+    /*
+     * write() all of buf, or fail; a short write counts as an I/O error
+     */
+
+    ssize_t n;
+
+
+    if ((n = write(fd, buf, len)) < 0)
+        return -1;
+
+    if ((size_t)n != len) {
+        errno = EIO;
+        return -1;
+    }
+
+    return 0;
+}
+
+int br_save_plan(br_plan *plan, char *path)
+{
+/*
+ * Write a plan out so it can be br_load_plan()ed later without going
+ *  near a command list.  It goes to a temporary file that's renamed into
+ *  place, so anyone loading it gets either the old one or the new one.
+ */
+
+    br_plan_header hdr;
+    char *tmppath;
+    int fd;
+    int rv;
+    int tmperrno;
+
+
+    if ((plan == NULL) || (path == NULL)) {
+        errno = EINVAL;
+        br_error("br_save_plan", "NULL pointer");
+        return -1;
+    }
+
+    if (plan->gap > BR_PLAN_MAX_GAP) {
+        errno = EINVAL;
+        br_error("br_save_plan", "Gap between frames too long to save");
+        return -1;
+    }
+
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.magic = BR_PLAN_MAGIC;
+    hdr.version = BR_PLAN_VERSION;
+    hdr.headerlen = sizeof(hdr);
+    hdr.framelen = sizeof(br_frame);
+    hdr.inverse = plan->inverse;
+    hdr.repeat = plan->repeat;
+    hdr.stream = plan->stream;
+    hdr.gap = plan->gap;
+    hdr.numframes = plan->numframes;
+    hdr.checksum = adler32((unsigned char *)plan->frames,
+      plan->numframes * sizeof(br_frame));
+
+    if ((tmppath = malloc(strlen(path) + 5)) == NULL) {
+        br_error("br_save_plan", "malloc");
+        return -1;
+    }
+
+    sprintf(tmppath, "%s.tmp", path);
+
+    if ((fd = open(tmppath, O_WRONLY | O_CREAT | O_TRUNC, 0666)) < 0) {
+        br_error("br_save_plan", "Unable to create plan file");
+        free(tmppath);
+        return -1;
+    }
+
+    if ((write_out(fd, &hdr, sizeof(hdr)) < 0)
+      || (write_out(fd, plan->frames, plan->numframes * sizeof(br_frame)) < 0))
+        goto fail;
+
+    /*
+     * Whether close() works or not, fd's gone after it
+     */
+
+    rv = close(fd);
+    fd = -1;
+
+    if ((rv < 0) || (rename(tmppath, path) < 0))
+        goto fail;
+
+    free(tmppath);
+
+    return 0;
+
+fail:
+    tmperrno = errno;
+
+    if (fd >= 0)
+        close(fd);
+
+    unlink(tmppath);
+    free(tmppath);
+    errno = tmperrno;
+    br_error("br_save_plan", "Unable to write plan file");
+
+    return -1;
+}
+
+br_plan *br_load_plan(char *path)
+{
+/*
+ * Map a plan saved by br_save_plan().  The frames are used right where
+ *  they are in the mapping; they're checked against the checksum and
+ *  against the frame table (so a damaged or doctored file can't send
+ *  anything a command list couldn't), but nothing's copied or rebuilt.
+ */
+
+    br_plan *plan;
+    br_plan_header *hdr;
+    struct stat sb;
+    void *map;
+    register uint32_t i;
+    br_frame *frame;
+    size_t framebytes;
+    int fd;
+    int tmperrno;
+
+
+    if (path == NULL) {
+        errno = EINVAL;
+        br_error("br_load_plan", "NULL path");
+        return NULL;
+    }
+
+    if ((fd = open(path, O_RDONLY)) < 0) {
+        br_error("br_load_plan", "Unable to open plan file");
+        return NULL;
+    }
+
+    if (fstat(fd, &sb) < 0) {
+        tmperrno = errno;
+        close(fd);
+        errno = tmperrno;
+        br_error("br_load_plan", "fstat");
+        return NULL;
+    }
+
+    if (sb.st_size < (off_t)sizeof(br_plan_header)) {
+        close(fd);
+        errno = EINVAL;
+        br_error("br_load_plan", "Not a BottleRocket plan file");
+        return NULL;
+    }
+
+    map = mmap(NULL, sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    tmperrno = errno;
+    close(fd);
+
+    if (map == MAP_FAILED) {
+        errno = tmperrno;
+        br_error("br_load_plan", "mmap");
+        return NULL;
+    }
+
+    hdr = map;
+
+    if ((hdr->magic != BR_PLAN_MAGIC)
+      || (hdr->headerlen < sizeof(br_plan_header))
+      || ((off_t)hdr->headerlen > sb.st_size)
+      || (hdr->framelen != sizeof(br_frame)))
+    {
+        errno = EINVAL;
+        br_error("br_load_plan", "Not a BottleRocket plan file");
+        goto fail;
+    }
+
+    if (hdr->version != BR_PLAN_VERSION) {
+        errno = EINVAL;
+        br_error("br_load_plan", "Plan file is from another version");
+        goto fail;
+    }
+
+    /*
+     * Everything after the header has to be whole frames, and exactly
+     *  as many as it says; the rest has to be something br_compile()
+     *  could have come up with
+     */
+
+    framebytes = (size_t)(sb.st_size - (off_t)hdr->headerlen);
+
+    if ((framebytes % sizeof(br_frame))
+      || ((hdr->inverse != 0) && (hdr->inverse != 1))
+      || (hdr->repeat < 1)
+      || ((hdr->stream != 0) && (hdr->stream != 1))
+      || (hdr->gap < -1) || (hdr->gap > BR_PLAN_MAX_GAP)
+      || (hdr->numframes != framebytes / sizeof(br_frame))
+      || (adler32((unsigned char *)map + hdr->headerlen,
+        hdr->numframes * sizeof(br_frame)) != hdr->checksum))
+    {
+        errno = EINVAL;
+        br_error("br_load_plan", "Plan file is damaged");
+        goto fail;
+    }
+
+    frame = (br_frame *)((char *)map + hdr->headerlen);
+
+    /*
+     * Dims and brights only ever go to a whole housecode (see
+     *  br_make_frame()), though the table has them for every device
+     */
+
+    for (i = 0; i < hdr->numframes; i++) {
+        if ((frame[i].cmd > PAUSE)
+          || (ISDIMCMD(frame[i].cmd) && (frame[i].unit & 0x0f))
+          || memcmp(frame[i].bytes, BR_FRAME_BYTES(frame[i].unit,
+            frame[i].cmd), BR_FRAME_LEN))
+        {
+            errno = EINVAL;
+            br_error("br_load_plan", "Plan file is damaged");
+            goto fail;
+        }
+    }
+
+    if ((plan = malloc(sizeof(br_plan))) == NULL) {
+        br_error("br_load_plan", "malloc");
+        goto fail;
+    }
+
+#ifdef MEM_DEBUG
+    printf("br_load_plan: Malloced %d bytes at %lx\n", sizeof(br_plan),
+      (unsigned long)plan);
+#endif
+
+    plan->inverse = hdr->inverse;
+    plan->repeat = hdr->repeat;
+    plan->stream = hdr->stream;
+    plan->gap = hdr->gap;
+    plan->numframes = hdr->numframes;
+    plan->frames = frame;
+    plan->map = map;
+    plan->maplen = sb.st_size;
+
+    return plan;
+
+fail:
+    tmperrno = errno;
+    munmap(map, sb.st_size);
+    errno = tmperrno;
+
+    return NULL;
+}
+
+/*
+ * The same, in a given context rather than the thread's own
+ */
+
+br_plan * br_compile_ctx(br_context *ctx, br_control_info *cinfo)
+{
+    br_context *old = br_use_context(ctx);
+    br_plan * rv;
+    int tmperrno;
+
+
+    rv = br_compile(cinfo);
+
+    tmperrno = errno;
+    br_use_context(old);
+    errno = tmperrno;
+
+    return rv;
+}
+
+int br_send_frame_ctx(br_context *ctx, int fd, const br_frame *frame)
+{
+    br_context *old = br_use_context(ctx);
+    int rv;
+    int tmperrno;
+
+
+    rv = br_send_frame(fd, frame);
+
+    tmperrno = errno;
+    br_use_context(old);
+    errno = tmperrno;
+
+    return rv;
+}
+
+int br_execute_plan_ctx(br_context *ctx, int fd, br_plan *plan)
+{
+    br_context *old = br_use_context(ctx);
+    int rv;
+    int tmperrno;
+
+
+    rv = br_execute_plan(fd, plan);
+
+    tmperrno = errno;
+    br_use_context(old);
+    errno = tmperrno;
+
+    return rv;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,117 @@
+#ifndef _BR_PLAN_H
+#define _BR_PLAN_H
+
+/*
+ * br_plan.h -- Compiled execution plans: a command list flattened into
+ *              the frames that will actually go out.
+ *
+ * (c) 1999 Tymm Twillman (tymm@acm.org)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "br_cmd.h"
+#include "br_cmd_engine.h"
+
+#define BR_FRAME_LEN 5
+
+/*
+ * Every possible frame, indexed by [housecode][device][command]; built
+ *  from br_translate.h by mkframes when the library is compiled.
+ */
+
+extern const unsigned char br_frame_table[16][16][PAUSE + 1][BR_FRAME_LEN];
+
+#define BR_FRAME_BYTES(unit, cmd) \
+          (br_frame_table[((unit) >> 4) & 0x0f][(unit) & 0x0f][(cmd)])
+
+/*
+ * One ready-to-send frame, plus what it means (for verbose output and
+ *  for turning it around when inverting)
+ */
+
+typedef struct {
+    unsigned char bytes[BR_FRAME_LEN];
+    unsigned char unit;         /* housecode << 4 | device */
+    unsigned char cmd;
+} br_frame;
+
+typedef struct {
+    int inverse;
+    int repeat;
+    int stream;
+    int gap;                    /* br_inter_frame_delay when compiled */
+    int numframes;
+    br_frame *frames;
+    void *map;                  /* file it was loaded from, if it was */
+    size_t maplen;
+} br_plan;
+
+/*
+ * A plan saved to a file (see br_save_plan()): this header, then the
+ *  frames just as they are in memory, so loading one is just mapping it.
+ *  Byte order is the machine's own; a file from the other kind shows up
+ *  as a bad magic number.
+ */
+
+#define BR_PLAN_MAGIC    0x4252504c     /* "BRPL" */
+#define BR_PLAN_VERSION  1
+
+#define BR_PLAN_MAX_GAP  60000000       /* uSec; longest gap a file can hold */
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t headerlen;         /* where the frames start */
+    uint32_t framelen;          /* sizeof(br_frame) */
+    int32_t inverse;
+    int32_t repeat;
+    int32_t stream;
+    int32_t gap;
+    uint32_t numframes;
+    uint32_t checksum;          /* Adler-32 of the frames */
+} br_plan_header;
+
+/*
+ * Walks through a plan, handing out repeats and inverted passes as it
+ *  goes rather than storing them
+ */
+
+typedef struct {
+    br_plan *plan;
+    int index;
+    int pass;
+    int inverse;
+    br_frame scratch;
+} br_plan_iter;
+
+int br_make_frame(br_frame *, unsigned char /* unit */, int /* cmd */);
+br_plan *br_compile(br_control_info *);
+int br_free_plan(br_plan *);
+void br_plan_iter_init(br_plan_iter *, br_plan *);
+const br_frame *br_plan_next(br_plan_iter *);
+int br_send_frame(int /* file desc */, const br_frame *);
+int br_execute_plan(int /* file desc */, br_plan *);
+int br_save_plan(br_plan *, char * /* path */);
+br_plan *br_load_plan(char * /* path */);
+br_plan *br_compile_ctx(br_context *, br_control_info *);
+int br_send_frame_ctx(br_context *, int /* file desc */, const br_frame *);
+int br_execute_plan_ctx(br_context *, int /* file desc */, br_plan *);
+
+#endif
@@ -0,0 +1,615 @@
+/*
+ * br_profile.c -- Named timing profiles, and the sweep that finds them.
+ *  (c) 1999 by Tymm Twillman (tymm@acm.org).
+ *
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ */
+
+#ifdef __cplusplus
+extern C {
+#endif
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <limits.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#endif
+
+#include "br_cmd.h"
+#include "br_plan.h"
+#include "br_backend.h"
+#include "br_decode.h"
+#include "br_profile.h"
+
+/*
+ * What a profile file may set; each is an int in br_context
+ */
+
+static struct {
+    char *name;
+    size_t offset;
+} settings[] = {
+    {"pre_cmd_delay",     offsetof(br_context, pre_cmd_delay)},
+    {"post_cmd_delay",    offsetof(br_context, post_cmd_delay)},
+    {"inter_bit_delay",   offsetof(br_context, inter_bit_delay)},
+    {"inter_frame_delay", offsetof(br_context, inter_frame_delay)},
+    {"spin_usecs",        offsetof(br_context, spin_usecs)},
+    {NULL, 0}
+};
+
+#define SETTING(ctx, i)  (*(int *)((char *)(ctx) + settings[i].offset))
+
+/*
+ * The grid each delay is swept over, in percent of where it started
+ */
+
+static int grid[] = {100, 85, 70, 60, 50, 40, 30, 20};
+
+#define GRID_SIZE  ((int)(sizeof(grid) / sizeof(grid[0])))
+
+typedef struct {
+    int inter_bit;
+    int pre;
+    int post;
+    double airtime;              /* for the whole plan, uSec */
+} candidate;
+
+
+char *br_profile_path(char *name)
+{
+/*
+ * Work out where a profile lives.  Anything with a / in it is a path
+ *  already; anything else goes in the profile directory.  The result is
+ *  to be free()d.
+ */
+
+    char *dir;
+    char *home;
+    char *path;
+    int len;
+
+
+    if (name == NULL) {
+        errno = EINVAL;
+        br_error("br_profile_path", "NULL profile name");
+        return NULL;
+    }
+
+    if (strchr(name, '/')) {
+        dir = NULL;
+        home = NULL;
+    } else if ((dir = getenv("BR_PROFILE_DIR"))) {
+        home = NULL;
+    } else if ((home = getenv("HOME"))) {
+        dir = BR_PROFILE_DIR;
+    } else {
+        errno = ENOENT;
+        br_error("br_profile_path", "No HOME to keep profiles in");
+        return NULL;
+    }
+
+    len = (home ? strlen(home) + 1:0) + (dir ? strlen(dir) + 1:0)
+      + strlen(name) + 1;
+
+    path = malloc(len);
+
+    if (path == NULL) {
+        br_error("br_profile_path", "malloc");
+        return NULL;
+    }
+
+#ifdef MEM_DEBUG
+    printf("br_profile_path: Malloced %d bytes at %lx\n", len,
+      (unsigned long)path);
+#endif
+
+    *path = '\0';
+
+    if (home)
+        sprintf(path, "%s/", home);
+
+    if (dir)
+        sprintf(path + strlen(path), "%s/", dir);
+
+    strcat(path, name);
+
+    return path;
+}
+
+int br_profile_load(char *name, br_context *ctx)
+{
+/*
+ * Set ctx's timing from a saved profile.  Settings the file doesn't
+ *  mention are left alone; if anything in it can't be made sense of,
+ *  nothing's changed at all.
+ */
+
+    br_context tmp;
+    FILE *f;
+    char *path;
+    char line[256];
+    char key[64];
+    char msg[128];
+    long value;
+    int lineno = 0;
+    int n;
+    register int i;
+
+
+    if (ctx == NULL) {
+        errno = EINVAL;
+        br_error("br_profile_load", "NULL context pointer");
+        return -1;
+    }
+
+    if ((path = br_profile_path(name)) == NULL)
+        return -1;
+
+    f = fopen(path, "r");
+
+#ifdef MEM_DEBUG
+    printf("br_profile_load: Freeing memory at %lx\n", (unsigned long)path);
+#endif
+
+    free(path);
+
+    if (f == NULL) {
+        br_error("br_profile_load", "Unable to open profile");
+        return -1;
+    }
+
+    tmp = *ctx;
+
+    while (fgets(line, sizeof(line), f)) {
+        lineno++;
+
+        n = sscanf(line, "%63s %ld", key, &value);
+
+        if ((n <= 0) || (*key == '#'))
+            continue;        /* blank, or a comment */
+
+        for (i = 0; settings[i].name; i++) {
+            if (!strcmp(key, settings[i].name))
+                break;
+        }
+
+        if ((n != 2) || !settings[i].name || (value < -1)
+          || (value > INT_MAX))
+        {
+            fclose(f);
+            errno = EINVAL;
+            sprintf(msg, "Bad setting on line %d of profile", lineno);
+            br_error("br_profile_load", msg);
+            return -1;
+        }
+
+        SETTING(&tmp, i) = (int)value;
+    }
+
+    if (ferror(f)) {
+        fclose(f);
+        br_error("br_profile_load", "Unable to read profile");
+        return -1;
+    }
+
+    fclose(f);
+
+    *ctx = tmp;
+
+    return 0;
+}
+
+int br_profile_save(char *name, br_context *ctx, char *comment)
+{
+/*
+ * Write ctx's timing out as a profile.  Like a plan, it goes to a
+ *  temporary file that's renamed into place.
+ */
+
+    FILE *f;
+    char *path;
+    char *tmppath;
+    char *slash;
+    int failed;
+    int tmperrno;
+    register int i;
+
+
+    if (ctx == NULL) {
+        errno = EINVAL;
+        br_error("br_profile_save", "NULL context pointer");
+        return -1;
+    }
+
+    if ((path = br_profile_path(name)) == NULL)
+        return -1;
+
+    /*
+     * The profile directory may not have been needed before now
+     */
+
+    if (!strchr(name, '/') && (slash = strrchr(path, '/'))) {
+        *slash = '\0';
+        mkdir(path, 0755);
+        *slash = '/';
+    }
+
+    if ((tmppath = malloc(strlen(path) + 5)) == NULL) {
+        br_error("br_profile_save", "malloc");
+        free(path);
+        return -1;
+    }
+
+    sprintf(tmppath, "%s.tmp", path);
+
+    if ((f = fopen(tmppath, "w")) == NULL) {
+        br_error("br_profile_save", "Unable to create profile");
+        free(tmppath);
+        free(path);
+        return -1;
+    }
+
+    fprintf(f, "# BottleRocket timing profile (uSec)\n");
+
+    if (comment)
+        fprintf(f, "# %s\n", comment);
+
+    for (i = 0; settings[i].name; i++)
+        fprintf(f, "%s %d\n", settings[i].name, SETTING(ctx, i));
+
+    failed = ferror(f);
+
+    /*
+     * Whether fclose() works or not, f's gone after it
+     */
+
+    if ((fclose(f) != 0) && !failed)
+        goto fail;
+
+    if (failed) {
+        errno = EIO;
+        goto fail;
+    }
+
+    if (rename(tmppath, path) < 0)
+        goto fail;
+
+    free(tmppath);
+
+#ifdef MEM_DEBUG
+    printf("br_profile_save: Freeing memory at %lx\n", (unsigned long)path);
+#endif
+
+    free(path);
+
+    return 0;
+
+fail:
+    tmperrno = errno;
+    unlink(tmppath);
+    free(tmppath);
+    free(path);
+    errno = tmperrno;
+    br_error("br_profile_save", "Unable to write profile");
+
+    return -1;
+}
+
+void br_sweep_init_opts(br_sweep_opts *opts)
+{
+    opts->model.min_half_bit = BR_RX_MIN_HALF_BIT;
+    opts->model.min_hold = BR_RX_MIN_HOLD;
+    opts->model.min_post = BR_RX_MIN_POST;
+    opts->model.jitter = 0;
+    opts->model.margin = BR_RX_MARGIN;
+    opts->trials = 3;
+    opts->log = NULL;
+}
+
+static long need(const br_rx_model *model, long usecs)
+{
+    /*
+     * What the receiver's really given to expect: its minimum, plus the
+     *  margin, plus whatever jitter we've been told to allow for
+     */
+
+    return usecs * (100 + model->margin) / 100 + model->jitter;
+}
+
+static int compare_candidates(const void *a, const void *b)
+{
+    /*
+     * Quickest first; of two as quick, the one with longer bits
+     */
+
+    const candidate *ca = a;
+    const candidate *cb = b;
+
+
+    if (ca->airtime != cb->airtime)
+        return (ca->airtime < cb->airtime) ? -1:1;
+
+    return cb->inter_bit - ca->inter_bit;
+}
+
+static char *out_of_range(const br_rx_model *model, const candidate *c,
+  int gap, int stream, int numframes)
+{
+    /*
+     * Anything the receiver's minimums rule out before it's even tried
+     */
+
+    if (c->inter_bit < need(model, model->min_half_bit))
+        return "half-bits too short for the receiver";
+
+    if (c->pre < need(model, model->min_hold))
+        return "pre-command hold too short for the receiver";
+
+    if (c->post < need(model, model->min_post))
+        return "post-command delay too short for the receiver";
+
+    if (stream && (numframes > 1) && ((gap < need(model, model->min_hold))
+      || (gap < need(model, model->min_post))))
+        return "gap between frames too short for the receiver";
+
+    return NULL;
+}
+
+static int try_candidate(br_context *trial, int fd, br_backend *backend,
+  br_plan *plan, const br_rx_model *model, long *worst, char **why)
+{
+    /*
+     * Send the plan once with trial's timing and read it back the way the
+     *  receiver would, as fussily as the model says it is.  Returns 1 if
+     *  it got through, 0 if it didn't (*why says how), -1 on errors.
+     */
+
+    br_decode_opts opts;
+    br_decoded *frames;
+    int numframes;
+    register int i;
+
+
+    if (br_virtual_reset(backend) < 0) {
+        br_error("br_sweep", "clock");
+        return -1;
+    }
+
+    if (br_execute_plan_ctx(trial, fd, plan) < 0)
+        return -1;
+
+    opts.half_bit = trial->inter_bit_delay;
+    opts.tolerance = trial->inter_bit_delay
+      - need(model, model->min_half_bit);
+    opts.min_hold = need(model, model->min_hold);
+
+    if ((numframes = br_decode(br_virtual_state(backend)->transitions,
+      br_virtual_state(backend)->numtransitions, &opts, &frames)) < 0)
+        return -1;
+
+    for (i = 0; i < numframes; i++) {
+        if (labs(frames[i].worst_error) > *worst)
+            *worst = labs(frames[i].worst_error);
+    }
+
+    *why = NULL;
+
+    if (br_decode_compare(frames, numframes, plan))
+        *why = "frames didn't decode as sent";
+
+    for (i = 1; !*why && (i < numframes); i++) {
+        if (frames[i].start - frames[i - 1].end < need(model, model->min_post))
+            *why = "frames too close together";
+    }
+
+    if (!*why && numframes && (br_virtual_elapsed(backend)
+      - frames[numframes - 1].end < need(model, model->min_post)))
+        *why = "lines let go of too soon after the last frame";
+
+    free(frames);
+
+    return *why ? 0:1;
+}
+
+int br_sweep(br_context *ctx, int fd, br_backend *port, br_plan *plan,
+  const br_sweep_opts *opts, br_context *best)
+{
+/*
+ * Try every combination of inter-bit, pre- and post-command delay on the
+ *  grid, quickest first, sending the plan through the real transmit path
+ *  each time -- to the port through a capture backend, or to a virtual
+ *  one if there's no port -- until one gets through opts->trials times
+ *  running.  On the port, whatever jitter there is shows up in what's
+ *  captured, and counts against the candidate.  Combinations the model
+ *  rules out anyway aren't sent at all.
+ *
+ * *best gets ctx with the winning timing.
+ */
+
+    br_sweep_opts defaults;
+    br_backend *backend;
+    br_context trial;
+    br_plan_iter iter;
+    const br_frame *frame;
+    candidate cands[GRID_SIZE * GRID_SIZE * GRID_SIZE];
+    candidate *c;
+    char *why;
+    long worst;
+    int numframes = 0;
+    int numcands = 0;
+    int gap;
+    int passed;
+    int rv;
+    register int i;
+    register int j;
+    register int k;
+
+
+    if ((ctx == NULL) || (plan == NULL) || (best == NULL)) {
+        errno = EINVAL;
+        br_error("br_sweep", "NULL pointer");
+        return -1;
+    }
+
+    if (plan->repeat == INT_MAX) {
+        errno = EINVAL;
+        br_error("br_sweep", "Can't sweep a plan that repeats forever");
+        return -1;
+    }
+
+    if (opts == NULL) {
+        br_sweep_init_opts(&defaults);
+        opts = &defaults;
+    }
+
+    br_plan_iter_init(&iter, plan);
+
+    while ((frame = br_plan_next(&iter)) != NULL) {
+        if (frame->cmd != PAUSE)
+            numframes++;
+    }
+
+    if (numframes == 0) {
+        errno = EINVAL;
+        br_error("br_sweep", "Nothing in the plan to send");
+        return -1;
+    }
+
+    /*
+     * Lay out the grid
+     */
+
+    for (i = 0; i < GRID_SIZE; i++) {
+        for (j = 0; j < GRID_SIZE; j++) {
+            for (k = 0; k < GRID_SIZE; k++) {
+                c = &cands[numcands++];
+                c->inter_bit = (long)ctx->inter_bit_delay * grid[i] / 100;
+                c->pre = (long)ctx->pre_cmd_delay * grid[j] / 100;
+                c->post = (long)ctx->post_cmd_delay * grid[k] / 100;
+
+                gap = (ctx->inter_frame_delay >= 0) ? ctx->inter_frame_delay
+                  :(c->pre > c->post) ? c->pre:c->post;
+
+                c->airtime = (double)numframes * BR_FRAME_LEN * 16
+                  * c->inter_bit;
+
+                if (plan->stream)
+                    c->airtime += c->pre + c->post
+                      + (double)(numframes - 1) * gap;
+                else
+                    c->airtime += (double)numframes * (c->pre + c->post);
+            }
+        }
+    }
+
+    qsort(cands, numcands, sizeof(candidate), compare_candidates);
+
+    backend = port ? br_new_capture_backend(port):br_new_virtual_backend();
+
+    if (backend == NULL)
+        return -1;
+
+    if (opts->log)
+        fprintf(opts->log, "inter-bit      pre     post  airtime\n");
+
+    for (i = 0; i < numcands; i++) {
+        c = &cands[i];
+
+        if (opts->log)
+            fprintf(opts->log, "%9d %8d %8d %7.3fs  ", c->inter_bit, c->pre,
+              c->post, c->airtime / 1000000.0);
+
+        gap = (ctx->inter_frame_delay >= 0) ? ctx->inter_frame_delay
+          :(c->pre > c->post) ? c->pre:c->post;
+
+        if ((why = out_of_range(&opts->model, c, gap, plan->stream,
+          numframes)))
+        {
+            if (opts->log)
+                fprintf(opts->log, "skipped: %s\n", why);
+
+            continue;
+        }
+
+        trial = *ctx;
+        trial.inter_bit_delay = c->inter_bit;
+        trial.pre_cmd_delay = c->pre;
+        trial.post_cmd_delay = c->post;
+        trial.backend = backend;
+
+        worst = 0;
+        why = NULL;
+
+        for (passed = 0; passed < (opts->trials > 1 ? opts->trials:1);
+          passed++)
+        {
+            if ((rv = try_candidate(&trial, fd, backend, plan, &opts->model,
+              &worst, &why)) < 0)
+            {
+                br_free_virtual_backend(backend);
+                return -1;
+            }
+
+            if (rv == 0)
+                break;
+        }
+
+        if (opts->log) {
+            if (why)
+                fprintf(opts->log, "failed: %s\n", why);
+            else
+                fprintf(opts->log, "passed, half-bits off by %ld uSec "
+                  "at worst\n", worst);
+
+            fflush(opts->log);
+        }
+
+        if (why == NULL) {
+            br_free_virtual_backend(backend);
+
+            *best = *ctx;
+            best->inter_bit_delay = c->inter_bit;
+            best->pre_cmd_delay = c->pre;
+            best->post_cmd_delay = c->post;
+
+            return 0;
+        }
+    }
+
+    br_free_virtual_backend(backend);
+
+    errno = ERANGE;
+    br_error("br_sweep", "Nothing on the grid got through");
+
+    return -1;
+}
+
+#ifdef __cplusplus
+}
+#endif
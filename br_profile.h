@@ -0,0 +1,80 @@
+#ifndef _BR_PROFILE_H
+#define _BR_PROFILE_H
+
+/*
+ * br_profile.h -- Timing profiles: a context's delays saved under a name
+ *                 and loaded back, and a sweep that sends a plan through
+ *                 the real transmit path at every timing on a grid, reads
+ *                 each run back the way the receiver would, and keeps the
+ *                 quickest one that still gets through with room to spare.
+ *
+ * (c) 1999 Tymm Twillman (tymm@acm.org)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <stdio.h>
+
+#include "br_cmd.h"
+#include "br_plan.h"
+#include "br_backend.h"
+
+/*
+ * Where profiles given by name (rather than by path) live: the
+ *  BR_PROFILE_DIR environment variable if it's set, otherwise this, under
+ *  the user's home directory
+ */
+
+#ifndef BR_PROFILE_DIR
+#define BR_PROFILE_DIR ".br"
+#endif
+
+/*
+ * What the receiver is taken to need, before any margin (uSec).  These
+ *  are guesses on the safe side; an adapter that's been watched closely
+ *  can be given its own.
+ */
+
+#define BR_RX_MIN_HALF_BIT  500      /* shortest half-bit it's sure to see */
+#define BR_RX_MIN_HOLD      50000    /* "clock" to power up before a frame */
+#define BR_RX_MIN_POST      200000   /* to get a frame out over the air */
+#define BR_RX_MARGIN        20       /* percent over all of those */
+
+typedef struct {
+    long min_half_bit;
+    long min_hold;
+    long min_post;           /* after a frame, before the next or the end */
+    long jitter;             /* allowed for on top of what's measured */
+    int margin;              /* percent */
+} br_rx_model;
+
+typedef struct {
+    br_rx_model model;
+    int trials;              /* runs each candidate has to get through */
+    FILE *log;               /* a line for every candidate, or NULL */
+} br_sweep_opts;
+
+char *br_profile_path(char * /* name or path */);
+int br_profile_load(char * /* name or path */, br_context *);
+int br_profile_save(char * /* name or path */, br_context *,
+              char * /* comment, or NULL */);
+
+void br_sweep_init_opts(br_sweep_opts *);
+int br_sweep(br_context * /* where to start from */, int /* file desc */,
+              br_backend * /* port's, or NULL to simulate */, br_plan *,
+              const br_sweep_opts *, br_context * /* the best, on success */);
+
+#endif
@@ -0,0 +1,795 @@
+/*
+ * br_sched.c -- A timing wheel of command lists waiting to go out.
+ *  (c) 1999 by Tymm Twillman (tymm@acm.org).
+ *
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ */
+
+#ifdef __cplusplus
+extern C {
+#endif
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#endif
+
+#include "br_cmd.h"
+#include "br_cmd_engine.h"
+#include "br_sched.h"
+
+#define WHEEL_MASK      (BR_WHEEL_SIZE - 1)
+#define WHEEL_SPAN      (BR_WHEEL_BITS * BR_WHEEL_LEVELS)
+
+#define ALL_MDAYS       0xfffffffeUL
+#define ALL_WDAYS       0x7fUL
+
+/*
+ * Furthest ahead br_calendar_next() looks, in steps; a calendar that
+ *  can't come up (February 30th) gives up rather than looping forever
+ */
+
+#define CALENDAR_TRIES  100000
+
+
+static void list_init(br_sched_link *head)
+{
+    head->next = head->prev = head;
+}
+
+static void list_add(br_sched_link *head, br_sched_link *link)
+{
+    link->prev = head->prev;
+    link->next = head;
+    head->prev->next = link;
+    head->prev = link;
+}
+
+static void list_del(br_sched_link *link)
+{
+    link->prev->next = link->next;
+    link->next->prev = link->prev;
+    link->next = link->prev = link;
+}
+
+static void list_splice(br_sched_link *to, br_sched_link *from)
+{
+    if (from->next == from)
+        return;
+
+    from->next->prev = to->prev;
+    to->prev->next = from->next;
+    from->prev->next = to;
+    to->prev = from->prev;
+
+    list_init(from);
+}
+
+br_sched *br_new_sched(time_t now)
+{
+    br_sched *sched;
+    register int l;
+    register int i;
+
+
+    if ((sched = malloc(sizeof(br_sched))) == NULL) {
+        br_error("br_new_sched", "malloc");
+        return NULL;
+    }
+
+#ifdef MEM_DEBUG
+    printf("br_new_sched: Malloced %d bytes at %lx\n", sizeof(br_sched),
+      (unsigned long)sched);
+#endif
+
+    memset(sched, 0, sizeof(br_sched));
+    sched->now = now;
+
+    for (l = 0; l < BR_WHEEL_LEVELS; l++) {
+        for (i = 0; i < BR_WHEEL_SIZE; i++)
+            list_init(&sched->wheel[l][i]);
+    }
+
+    list_init(&sched->overflow);
+    list_init(&sched->ready);
+
+    return sched;
+}
+
+static void free_list(br_sched_link *head)
+{
+    br_event *ev;
+
+
+    while (head->next != head) {
+        ev = (br_event *)head->next;
+        list_del(&ev->link);
+        br_free_control_info(ev->cinfo);
+        free(ev);
+    }
+}
+
+int br_free_sched(br_sched *sched)
+{
+    register int l;
+    register int i;
+
+
+    if (sched == NULL)
+        return 0;
+
+    for (l = 0; l < BR_WHEEL_LEVELS; l++) {
+        for (i = 0; i < BR_WHEEL_SIZE; i++)
+            free_list(&sched->wheel[l][i]);
+    }
+
+    free_list(&sched->overflow);
+    free_list(&sched->ready);
+
+#ifdef MEM_DEBUG
+    printf("br_free_sched: Freeing memory at %lx\n", (unsigned long)sched);
+#endif
+
+    free(sched);
+
+    return 0;
+}
+
+static void insert(br_sched *sched, br_event *ev)
+{
+/*
+ * An event goes on the lowest ring where it and now agree on every bit
+ *  above that ring's; its slot there is always ahead of now's, so it's
+ *  reached (and moved down a ring) before it's due.
+ */
+
+    unsigned long due = ev->due;
+    unsigned long now = sched->now;
+    register int l;
+
+
+    if (ev->due <= sched->now) {
+        list_add(&sched->ready, &ev->link);
+        return;
+    }
+
+    for (l = 0; l < BR_WHEEL_LEVELS; l++) {
+        if ((due >> (BR_WHEEL_BITS * (l + 1)))
+          == (now >> (BR_WHEEL_BITS * (l + 1))))
+        {
+            list_add(&sched->wheel[l][(due >> (BR_WHEEL_BITS * l))
+              & WHEEL_MASK], &ev->link);
+            sched->inwheel++;
+            return;
+        }
+    }
+
+    list_add(&sched->overflow, &ev->link);
+    sched->inwheel++;
+}
+
+static void cascade(br_sched *sched, br_sched_link *slot)
+{
+    br_sched_link list;
+    br_event *ev;
+
+
+    list_init(&list);
+    list_splice(&list, slot);
+
+    while (list.next != &list) {
+        ev = (br_event *)list.next;
+        list_del(&ev->link);
+        sched->inwheel--;
+        insert(sched, ev);
+    }
+}
+
+static void tick(br_sched *sched)
+{
+/*
+ * One second on.  When a ring comes round to slot 0, the next ring up
+ *  moves on a slot and whatever's there is spread out over the rings
+ *  below.
+ */
+
+    unsigned long now;
+    register int l;
+    int top;
+
+
+    now = ++sched->now;
+
+    for (top = 0; (top < BR_WHEEL_LEVELS)
+      && !(now & ((1UL << (BR_WHEEL_BITS * (top + 1))) - 1)); top++)
+        ;
+
+    if (top == BR_WHEEL_LEVELS)
+        cascade(sched, &sched->overflow);
+
+    for (l = (top < BR_WHEEL_LEVELS) ? top:BR_WHEEL_LEVELS - 1; l > 0; l--)
+        cascade(sched, &sched->wheel[l][(now >> (BR_WHEEL_BITS * l))
+          & WHEEL_MASK]);
+
+    cascade(sched, &sched->wheel[0][now & WHEEL_MASK]);
+}
+
+static br_event *new_event(br_sched *sched, int kind, time_t due,
+  br_control_info *cinfo)
+{
+    br_event *ev;
+
+
+    if ((sched == NULL) || (cinfo == NULL)) {
+        errno = EINVAL;
+        br_error("br_sched", "NULL pointer");
+        return NULL;
+    }
+
+    if ((ev = malloc(sizeof(br_event))) == NULL) {
+        br_error("br_sched", "malloc");
+        return NULL;
+    }
+
+#ifdef MEM_DEBUG
+    printf("br_sched: Malloced %d bytes at %lx\n", sizeof(br_event),
+      (unsigned long)ev);
+#endif
+
+    memset(ev, 0, sizeof(br_event));
+    list_init(&ev->link);
+    ev->kind = kind;
+    ev->due = due;
+    ev->cinfo = cinfo;
+    ev->seq = sched->seq++;
+
+    return ev;
+}
+
+br_event *br_sched_at(br_sched *sched, time_t when, br_control_info *cinfo)
+{
+/*
+ * From here on cinfo belongs to the event
+ */
+
+    br_event *ev;
+
+
+    if ((ev = new_event(sched, BR_EVENT_ONCE, when, cinfo)) == NULL)
+        return NULL;
+
+    insert(sched, ev);
+    sched->stats.pending++;
+
+    return ev;
+}
+
+br_event *br_sched_every(br_sched *sched, time_t first, long secs,
+  br_control_info *cinfo)
+{
+    br_event *ev;
+
+
+    if (secs <= 0) {
+        errno = EINVAL;
+        br_error("br_sched_every", "Interval must be at least a second");
+        return NULL;
+    }
+
+    if ((ev = new_event(sched, BR_EVENT_INTERVAL, first, cinfo)) == NULL)
+        return NULL;
+
+    ev->interval = secs;
+    insert(sched, ev);
+    sched->stats.pending++;
+
+    return ev;
+}
+
+br_event *br_sched_calendar(br_sched *sched, const br_calendar *cal,
+  br_control_info *cinfo)
+{
+    br_event *ev;
+    time_t due;
+
+
+    if (cal == NULL) {
+        errno = EINVAL;
+        br_error("br_sched_calendar", "NULL calendar");
+        return NULL;
+    }
+
+    if ((due = br_calendar_next(cal, sched ? sched->now:0)) < 0)
+        return NULL;
+
+    if ((ev = new_event(sched, BR_EVENT_CALENDAR, due, cinfo)) == NULL)
+        return NULL;
+
+    ev->cal = *cal;
+    insert(sched, ev);
+    sched->stats.pending++;
+
+    return ev;
+}
+
+int br_sched_cancel(br_sched *sched, br_event *ev)
+{
+    if ((sched == NULL) || (ev == NULL)) {
+        errno = EINVAL;
+        br_error("br_sched_cancel", "NULL pointer");
+        return -1;
+    }
+
+    if (ev->due > sched->now)
+        sched->inwheel--;
+
+    list_del(&ev->link);
+    sched->stats.pending--;
+
+    br_free_control_info(ev->cinfo);
+    free(ev);
+
+    return 0;
+}
+
+static int append(br_control_info *to, br_control_info *from)
+{
+/*
+ * Add all of from's commands to the end of to's, or (if that can't be
+ *  done) none of them
+ */
+
+    br_unit_list *units;
+    int had = to->numcmds;
+    register int i;
+
+
+    for (i = 0; i < from->numcmds; i++) {
+        if ((units = br_new_cmd_unit_list(to)) == NULL)
+            goto fail;
+
+        if (from->units[i])
+            br_ul_copy(units, from->units[i]);
+
+        if (br_add_ul_cmd_take(to, from->cmds[i], units) < 0) {
+            br_free_unit_list(units);
+            goto fail;
+        }
+    }
+
+    return 0;
+
+fail:
+    while (to->numcmds > had)
+        br_del_cmd(to, to->numcmds - 1);
+
+    return -1;
+}
+
+static br_control_info *new_batch(br_control_info *like)
+{
+    br_control_info *batch;
+
+
+    if ((batch = br_new_control_info()) == NULL)
+        return NULL;
+
+    batch->inverse = like->inverse;
+    batch->repeat = like->repeat;
+    batch->retx = like->retx;
+    batch->stream = like->stream;
+    batch->priority = like->priority;
+    batch->gap = like->gap;
+
+    return batch;
+}
+
+static void flush(br_sched *sched, br_control_info *batch,
+  br_sched_fire fire, void *arg)
+{
+    if (batch->numcmds == 0) {
+        br_free_control_info(batch);
+        return;
+    }
+
+    sched->stats.batches++;
+    (*fire)(batch, arg);
+}
+
+static int by_due(const void *a, const void *b)
+{
+    const br_event *x = *(const br_event **)a;
+    const br_event *y = *(const br_event **)b;
+
+
+    if (x->due != y->due)
+        return (x->due < y->due) ? -1:1;
+
+    return (x->seq < y->seq) ? -1:(x->seq > y->seq);
+}
+
+static void rearm(br_sched *sched, br_event *ev)
+{
+/*
+ * Next time round for an event that's just gone off.  Any times missed
+ *  while nobody was running the scheduler are skipped, not made up.
+ */
+
+    long behind;
+
+
+    switch (ev->kind) {
+        case BR_EVENT_INTERVAL:
+            behind = (sched->now - ev->due) / ev->interval;
+            ev->due += (behind + 1) * ev->interval;
+            break;
+
+        case BR_EVENT_CALENDAR:
+            if ((ev->due = br_calendar_next(&ev->cal, sched->now)) >= 0)
+                break;
+
+            /*
+             * It's not coming round again
+             */
+
+            /* FALLTHROUGH */
+
+        default:
+            sched->stats.pending--;
+            br_free_control_info(ev->cinfo);
+            free(ev);
+            return;
+    }
+
+    insert(sched, ev);
+}
+
+int br_sched_run(br_sched *sched, const struct timespec *now,
+  br_sched_fire fire, void *arg)
+{
+/*
+ * Bring the wheel up to now and fire everything that's come due: all of
+ *  it in one command list, in the order it was due (and then the order
+ *  it was added), so nothing due together has to fight over the port.
+ *  Lists that repeat, invert or send copies can't be run together with
+ *  anything else, so each of those goes separately, after what was due
+ *  before it.  Returns how many events went off.
+ */
+
+    br_event **due;
+    br_event *ev;
+    br_control_info *batch = NULL;
+    br_control_info *single;
+    br_sched_link *link;
+    long late;
+    int numdue = 0;
+    register int i;
+
+
+    if ((sched == NULL) || (now == NULL) || (fire == NULL)) {
+        errno = EINVAL;
+        br_error("br_sched_run", "NULL pointer");
+        return -1;
+    }
+
+    /*
+     * Nothing in the wheel means nothing to step through
+     */
+
+    while (sched->now < now->tv_sec) {
+        if (sched->inwheel == 0) {
+            sched->now = now->tv_sec;
+            break;
+        }
+
+        tick(sched);
+    }
+
+    for (link = sched->ready.next; link != &sched->ready; link = link->next)
+        numdue++;
+
+    if (numdue == 0)
+        return 0;
+
+    if ((due = malloc(numdue * sizeof(br_event *))) == NULL) {
+        br_error("br_sched_run", "malloc");
+        return -1;
+    }
+
+    for (i = 0; i < numdue; i++) {
+        due[i] = (br_event *)sched->ready.next;
+        list_del(&due[i]->link);
+    }
+
+    qsort(due, numdue, sizeof(br_event *), by_due);
+
+    sched->stats.late_last = 0;
+
+    for (i = 0; i < numdue; i++) {
+        ev = due[i];
+
+        late = (now->tv_sec - ev->due) * 1000 + now->tv_nsec / 1000000;
+
+        if (late > sched->stats.late_last)
+            sched->stats.late_last = late;
+
+        if (late > sched->stats.late_max)
+            sched->stats.late_max = late;
+
+        sched->stats.late_total += late;
+        sched->stats.fired++;
+
+        if (ev->cinfo->inverse || (ev->cinfo->repeat != 1)
+          || br_has_copies(ev->cinfo))
+        {
+
+            /*
+             * Whatever's been batched up so far was due first, so it
+             *  goes first
+             */
+
+            if (batch) {
+                flush(sched, batch, fire, arg);
+                batch = NULL;
+            }
+
+            if (((single = new_batch(ev->cinfo)) == NULL)
+              || (append(single, ev->cinfo) < 0))
+            {
+                br_error("br_sched_run", "Unable to send due commands");
+                br_free_control_info(single);
+            } else {
+                sched->stats.batches++;
+                (*fire)(single, arg);
+            }
+        } else if ((batch == NULL)
+          && ((batch = new_batch(ev->cinfo)) == NULL))
+        {
+            br_error("br_sched_run", "Unable to send due commands");
+        } else if (append(batch, ev->cinfo) < 0) {
+            br_error("br_sched_run", "Unable to send due commands");
+        } else {
+
+            /*
+             * The batch is as urgent as the most urgent thing in it
+             */
+
+            if (ev->cinfo->priority < batch->priority)
+                batch->priority = ev->cinfo->priority;
+
+            batch->stream = batch->stream && ev->cinfo->stream;
+
+            if (batch->gap != ev->cinfo->gap)
+                batch->gap = -1;
+        }
+
+        rearm(sched, ev);
+    }
+
+    free(due);
+
+    if (batch)
+        flush(sched, batch, fire, arg);
+
+    return numdue;
+}
+
+int br_sched_get_stats(br_sched *sched, br_sched_stats *copy)
+{
+    if ((sched == NULL) || (copy == NULL)) {
+        errno = EINVAL;
+        br_error("br_sched_get_stats", "NULL pointer");
+        return -1;
+    }
+
+    *copy = sched->stats;
+
+    return 0;
+}
+
+static int cal_field(char **str, uint64_t *bits, int lo, int hi)
+{
+/*
+ * One cron field: "*", or a comma separated list of numbers and ranges,
+ *  each maybe with a "/step"
+ */
+
+    char *p = *str;
+    char *end;
+    long from;
+    long to;
+    long step;
+    long n;
+
+
+    *bits = 0;
+
+    for (;;) {
+        if (*p == '*') {
+            from = lo;
+            to = hi;
+            p++;
+        } else {
+            from = strtol(p, &end, 10);
+
+            if (end == p)
+                return -1;
+
+            p = end;
+            to = from;
+
+            if (*p == '-') {
+                to = strtol(++p, &end, 10);
+
+                if (end == p)
+                    return -1;
+
+                p = end;
+            }
+        }
+
+        step = 1;
+
+        if (*p == '/') {
+            step = strtol(++p, &end, 10);
+
+            if ((end == p) || (step <= 0))
+                return -1;
+
+            p = end;
+        }
+
+        if ((from < lo) || (to > hi) || (from > to))
+            return -1;
+
+        for (n = from; n <= to; n += step)
+            *bits |= (uint64_t)1 << n;
+
+        if (*p != ',')
+            break;
+
+        p++;
+    }
+
+    if (*p && !isspace(*p))
+        return -1;
+
+    *str = p;
+
+    return 0;
+}
+
+int br_strtocal(char *str, br_calendar *cal, char **end)
+{
+/*
+ * Five fields, as in a crontab: minute, hour, day of the month, month
+ *  and day of the week (0 or 7 for Sunday)
+ */
+
+    uint64_t bits[5];
+    static int lo[5] = { 0, 0, 1, 1, 0 };
+    static int hi[5] = { 59, 23, 31, 12, 7 };
+    register int i;
+
+
+    if ((str == NULL) || (cal == NULL)) {
+        errno = EINVAL;
+        br_error("br_strtocal", "NULL pointer");
+        return -1;
+    }
+
+    for (i = 0; i < 5; i++) {
+        while (isspace(*str))
+            str++;
+
+        if (cal_field(&str, &bits[i], lo[i], hi[i]) < 0) {
+            errno = EINVAL;
+            br_error("br_strtocal", "Bad calendar (should be MIN HOUR MDAY "
+              "MONTH WDAY, as for cron)");
+            return -1;
+        }
+    }
+
+    if (bits[4] & (1 << 7))
+        bits[4] = (bits[4] | 1) & ALL_WDAYS;
+
+    cal->minutes = bits[0];
+    cal->hours = bits[1];
+    cal->mdays = bits[2];
+    cal->months = bits[3];
+    cal->wdays = bits[4];
+
+    if (end)
+        *end = str;
+
+    return 0;
+}
+
+static int day_ok(const br_calendar *cal, const struct tm *tm)
+{
+    int mday = (cal->mdays >> tm->tm_mday) & 1;
+    int wday = (cal->wdays >> tm->tm_wday) & 1;
+
+
+    if ((cal->mdays != ALL_MDAYS) && (cal->wdays != ALL_WDAYS))
+        return mday || wday;
+
+    return mday && wday;
+}
+
+time_t br_calendar_next(const br_calendar *cal, time_t after)
+{
+/*
+ * The first minute after "after" that the calendar allows, local time.
+ *  Whole months, days and hours that can't match are skipped at once.
+ */
+
+    struct tm tm;
+    time_t t;
+    register int tries;
+
+
+    t = after - (after % 60) + 60;
+    localtime_r(&t, &tm);
+
+    for (tries = 0; tries < CALENDAR_TRIES; tries++) {
+        if (!((cal->months >> (tm.tm_mon + 1)) & 1)) {
+            tm.tm_mon++;
+            tm.tm_mday = 1;
+            tm.tm_hour = 0;
+            tm.tm_min = 0;
+        } else if (!day_ok(cal, &tm)) {
+            tm.tm_mday++;
+            tm.tm_hour = 0;
+            tm.tm_min = 0;
+        } else if (!((cal->hours >> tm.tm_hour) & 1)) {
+            tm.tm_hour++;
+            tm.tm_min = 0;
+        } else if (!((cal->minutes >> tm.tm_min) & 1)) {
+            tm.tm_min++;
+        } else {
+            return t;
+        }
+
+        tm.tm_sec = 0;
+        tm.tm_isdst = -1;
+
+        if ((t = mktime(&tm)) == (time_t)-1)
+            break;
+
+        localtime_r(&t, &tm);
+    }
+
+    errno = ERANGE;
+    br_error("br_calendar_next", "Calendar never comes up");
+
+    return -1;
+}
+
+#ifdef __cplusplus
+}
+#endif
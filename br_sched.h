@@ -0,0 +1,119 @@
+#ifndef _BR_SCHED_H
+#define _BR_SCHED_H
+
+/*
+ * br_sched.h -- Commands that go out at set times: once, every so often,
+ *               or cron style.  Events are kept on a timing wheel, so
+ *               adding one and firing one take the same time however
+ *               many there are, and everything that comes due at once
+ *               goes out as one command list.
+ *
+ * (c) 1999 Tymm Twillman (tymm@acm.org)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <stdint.h>
+#include <time.h>
+
+#include "br_cmd_engine.h"
+
+/*
+ * The wheel: BR_WHEEL_LEVELS rings of BR_WHEEL_SIZE one-second slots
+ *  each, every ring's slots as long as a whole turn of the one below.
+ *  That covers about 194 days; anything further off waits on a list of
+ *  its own until it's in range.
+ */
+
+#define BR_WHEEL_BITS    6
+#define BR_WHEEL_SIZE    (1 << BR_WHEEL_BITS)
+#define BR_WHEEL_LEVELS  4
+
+#define BR_EVENT_ONCE      0
+#define BR_EVENT_INTERVAL  1
+#define BR_EVENT_CALENDAR  2
+
+/*
+ * When a calendar event goes off, cron style: a bit for each minute,
+ *  hour, day of the month, month and day of the week (Sunday is 0) it
+ *  may go off in.  If both kinds of day are limited, either will do.
+ */
+
+typedef struct {
+    uint64_t minutes;            /* 0 - 59 */
+    uint32_t hours;              /* 0 - 23 */
+    uint32_t mdays;              /* 1 - 31 */
+    uint32_t months;             /* 1 - 12 */
+    uint32_t wdays;              /* 0 - 6 */
+} br_calendar;
+
+typedef struct br_sched_link {
+    struct br_sched_link *next;
+    struct br_sched_link *prev;
+} br_sched_link;
+
+typedef struct {
+    br_sched_link link;          /* must be first */
+    int kind;                    /* BR_EVENT_* */
+    time_t due;
+    long interval;               /* seconds, for BR_EVENT_INTERVAL */
+    br_calendar cal;             /* for BR_EVENT_CALENDAR */
+    br_control_info *cinfo;      /* belongs to the event */
+    unsigned long seq;           /* order added, to break ties */
+} br_event;
+
+typedef struct {
+    unsigned long fired;         /* events */
+    unsigned long batches;       /* command lists they went out as */
+    long late_last;              /* mSec past due, last batch */
+    long late_max;
+    double late_total;           /* over every event */
+    int pending;                 /* events waiting */
+} br_sched_stats;
+
+typedef struct {
+    time_t now;                  /* every second up to this is done */
+    br_sched_link wheel[BR_WHEEL_LEVELS][BR_WHEEL_SIZE];
+    br_sched_link overflow;      /* too far off for the wheel */
+    br_sched_link ready;         /* due, not fired yet */
+    int inwheel;
+    unsigned long seq;
+    br_sched_stats stats;
+} br_sched;
+
+/*
+ * Gets each batch of commands that come due together; the command list
+ *  is the callback's to keep (br_submit() it, say)
+ */
+
+typedef void (*br_sched_fire)(br_control_info *, void * /* arg */);
+
+br_sched *br_new_sched(time_t /* now */);
+int br_free_sched(br_sched *);
+br_event *br_sched_at(br_sched *, time_t /* when */, br_control_info *);
+br_event *br_sched_every(br_sched *, time_t /* first */, long /* seconds */,
+              br_control_info *);
+br_event *br_sched_calendar(br_sched *, const br_calendar *,
+              br_control_info *);
+int br_sched_cancel(br_sched *, br_event *);
+int br_sched_run(br_sched *, const struct timespec * /* now, wall clock */,
+              br_sched_fire, void * /* arg */);
+int br_sched_get_stats(br_sched *, br_sched_stats *);
+
+int br_strtocal(char *, br_calendar *, char ** /* end */);
+time_t br_calendar_next(const br_calendar *, time_t /* after */);
+
+#endif
@@ -0,0 +1,740 @@
+/*
+ * br_state.c -- The assumed state of every unit, kept in a file that's
+ *  mapped into every process that sends commands, so they all agree
+ *  without having to talk to each other.
+ *  (c) 1999 by Tymm Twillman (tymm@acm.org).
+ *
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ */
+
+#ifdef __cplusplus
+extern C {
+#endif
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <time.h>
+#include <sched.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#endif
+
+#include "br_cmd.h"
+#include "br_state.h"
+
+/*
+ * Records are only ever held for a few stores, so anyone who's been
+ *  waiting this long is waiting on a process that died mid-update
+ */
+
+#define SPIN_LIMIT 10000
+
+#define LOAD(p)         __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define CAS(p, old, new) \
+          __atomic_compare_exchange_n((p), (old), (new), 0, \
+            __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)
+#define FENCE()         __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+#ifndef O_NOFOLLOW
+#define O_NOFOLLOW 0
+#endif
+
+static br_state *current = NULL;
+
+
+static void open_error(int quiet, char *problem)
+{
+    if (!quiet)
+        br_error("br_state_open", problem);
+}
+
+br_state *br_state_open(char *path, int writable)
+{
+/*
+ * Open (and, if writable, create) the state file.  Only a plain file that
+ *  just its owner can write to is used, and we only write to it if that's
+ *  us or root; otherwise it's anybody's guess what ends up in it.
+ *
+ * Keeping state is optional, so when it's the default file being opened
+ *  for writing, there's no complaint if it can't be had; NULL comes back
+ *  and the caller just goes without.
+ */
+
+    br_state *st;
+    struct stat sb;
+    uint32_t zero = 0;
+    int quiet = (path == NULL) && writable;
+    int tmperrno;
+
+
+    if (path == NULL)
+        path = getenv("BR_STATEFILE") ? getenv("BR_STATEFILE"):BR_STATEFILE;
+
+    if ((st = malloc(sizeof(br_state))) == NULL) {
+        open_error(quiet, "malloc");
+        return NULL;
+    }
+
+#ifdef MEM_DEBUG
+    printf("br_state_open: Malloced %d bytes at %lx\n", sizeof(br_state),
+      (unsigned long)st);
+#endif
+
+    st->writable = writable;
+    st->map = NULL;
+
+    if ((st->fd = open(path, (writable ? (O_RDWR | O_CREAT):O_RDONLY)
+      | O_NOFOLLOW, 0644)) < 0)
+    {
+        open_error(quiet, "Unable to open state file");
+        goto fail;
+    }
+
+    if (fstat(st->fd, &sb) < 0) {
+        open_error(quiet, "fstat");
+        goto fail;
+    }
+
+    if (!S_ISREG(sb.st_mode) || (sb.st_mode & (S_IWGRP | S_IWOTH))
+      || (writable && (sb.st_uid != geteuid()) && (sb.st_uid != 0)))
+    {
+        errno = EPERM;
+        open_error(quiet, "State file isn't safe to use");
+        goto fail;
+    }
+
+    /*
+     * A new file is all zeroes: every unit unknown
+     */
+
+    if (sb.st_size < (off_t)sizeof(br_state_file)) {
+        if (!writable) {
+            errno = ENODATA;
+            open_error(quiet, "No state recorded yet");
+            goto fail;
+        }
+
+        if (ftruncate(st->fd, sizeof(br_state_file)) < 0) {
+            open_error(quiet, "ftruncate");
+            goto fail;
+        }
+    }
+
+    st->map = mmap(NULL, sizeof(br_state_file),
+      writable ? (PROT_READ | PROT_WRITE):PROT_READ, MAP_SHARED, st->fd, 0);
+
+    if (st->map == MAP_FAILED) {
+        st->map = NULL;
+        open_error(quiet, "mmap");
+        goto fail;
+    }
+
+    if (writable && CAS(&st->map->magic, &zero, BR_STATE_MAGIC)) {
+        st->map->version = BR_STATE_VERSION;
+        st->map->numunits = BR_NUM_UNITS;
+    }
+
+    FENCE();
+
+    if ((st->map->magic != BR_STATE_MAGIC)
+      || (st->map->version != BR_STATE_VERSION)
+      || (st->map->numunits != BR_NUM_UNITS))
+    {
+        errno = EINVAL;
+        open_error(quiet, "Not a BottleRocket state file");
+        goto fail;
+    }
+
+    return st;
+
+fail:
+    tmperrno = errno;
+    br_state_close(st);
+    errno = tmperrno;
+
+    return NULL;
+}
+
+int br_state_close(br_state *st)
+{
+    if (st == NULL)
+        return 0;
+
+    if (current == st)
+        current = NULL;
+
+    if (st->map)
+        munmap(st->map, sizeof(br_state_file));
+
+    if (st->fd >= 0)
+        close(st->fd);
+
+#ifdef MEM_DEBUG
+    printf("br_state_close: Freeing memory at %lx\n", (unsigned long)st);
+#endif
+
+    free(st);
+
+    return 0;
+}
+
+static br_unit_state *lock_unit(br_state *st, int unit)
+{
+    br_unit_state *u = &st->map->units[unit];
+    uint32_t seq;
+    register int tries;
+
+
+    for (tries = 0; tries < SPIN_LIMIT; tries++) {
+        seq = LOAD(&u->seq);
+
+        if (!(seq & 1) && CAS(&u->seq, &seq, seq + 1))
+            return u;
+
+        sched_yield();
+    }
+
+    /*
+     * Whoever had it isn't coming back; carry on as if we'd got it
+     */
+
+    __atomic_store_n(&u->seq, LOAD(&u->seq) | 1, __ATOMIC_RELAXED);
+    FENCE();
+
+    return u;
+}
+
+static void unlock_unit(br_unit_state *u)
+{
+    __atomic_add_fetch(&u->seq, 1, __ATOMIC_RELEASE);
+}
+
+static void apply(br_unit_state *u, int cmd, time_t now)
+{
+/*
+ * What a command does to a unit that hears it.  An ON leaves a lamp
+ *  that's already on where it was, and brings one that's off on at full;
+ *  so does a DIM or BRIGHT, before it steps.  The lamp commands could
+ *  mean anything, since there's no telling which units are lamps.
+ */
+
+    int step;
+
+
+    switch (cmd) {
+        case ON:
+        case ALL_ON:
+            if (u->state == BR_STATE_OFF)
+                u->level_lo = BR_STATE_FULL;
+
+            if (u->state != BR_STATE_ON)
+                u->level_hi = BR_STATE_FULL;
+
+            u->state = BR_STATE_ON;
+            break;
+
+        case OFF:
+        case ALL_OFF:
+            u->state = BR_STATE_OFF;
+            break;
+
+        case DIM:
+        case BRIGHT:
+            if (u->state == BR_STATE_OFF)
+                u->level_lo = BR_STATE_FULL;
+
+            if (u->state != BR_STATE_ON)
+                u->level_hi = BR_STATE_FULL;
+
+            step = (cmd == DIM) ? -1:1;
+
+            u->level_lo += step;
+            u->level_hi += step;
+
+            if (u->level_lo < 0)
+                u->level_lo = 0;
+
+            if (u->level_lo > BR_STATE_FULL)
+                u->level_lo = BR_STATE_FULL;
+
+            if (u->level_hi < 0)
+                u->level_hi = 0;
+
+            if (u->level_hi > BR_STATE_FULL)
+                u->level_hi = BR_STATE_FULL;
+
+            u->state = BR_STATE_ON;
+            break;
+
+        case ALL_LAMPS_ON:
+        case ALL_LAMPS_OFF:
+            u->state = BR_STATE_UNKNOWN;
+            u->level_lo = 0;
+            u->level_hi = BR_STATE_FULL;
+            break;
+
+        default:
+            return;
+    }
+
+    u->when = now;
+}
+
+static void record_unit(br_state *st, int unit, int cmd, time_t now)
+{
+    br_unit_state *u = lock_unit(st, unit);
+
+
+    if (u->when == 0) {
+        u->level_lo = 0;
+        u->level_hi = BR_STATE_FULL;
+    }
+
+    apply(u, cmd, now);
+    unlock_unit(u);
+}
+
+int br_state_get(br_state *st, int unit, br_unit_state *copy)
+{
+    br_unit_state *u;
+    uint32_t seq;
+    register int tries;
+
+
+    if ((st == NULL) || (copy == NULL) || (unit < 0)
+      || (unit >= BR_NUM_UNITS))
+    {
+        errno = EINVAL;
+        br_error("br_state_get", "Bad state or unit");
+        return -1;
+    }
+
+    u = &st->map->units[unit];
+
+    for (tries = 0; tries < SPIN_LIMIT; tries++) {
+        seq = LOAD(&u->seq);
+
+        if (seq & 1) {
+            sched_yield();
+            continue;
+        }
+
+        *copy = *u;
+        FENCE();
+
+        if (LOAD(&u->seq) == seq)
+            break;
+    }
+
+    /*
+     * Never been sent anything
+     */
+
+    if (copy->when == 0) {
+        copy->state = BR_STATE_UNKNOWN;
+        copy->level_lo = 0;
+        copy->level_hi = BR_STATE_FULL;
+    }
+
+    return 0;
+}
+
+int br_state_record(br_state *st, int unit, int cmd)
+{
+/*
+ * Note what a frame that just went out will have done.  Dims go to the
+ *  last unit addressed in the housecode.
+ */
+
+    time_t now = time(NULL);
+    int house = BR_UNIT_HOUSE(unit);
+    int dev;
+
+
+    if ((st == NULL) || !st->writable) {
+        errno = EINVAL;
+        br_error("br_state_record", "State not open for writing");
+        return -1;
+    }
+
+    switch (cmd) {
+        case ON:
+        case OFF:
+            record_unit(st, unit, cmd, now);
+            __atomic_store_n(&st->map->lastunit[house], unit + 1,
+              __ATOMIC_RELEASE);
+            break;
+
+        case DIM:
+        case BRIGHT:
+            if ((unit = LOAD(&st->map->lastunit[house]) - 1) >= 0)
+                record_unit(st, unit, cmd, now);
+            break;
+
+        case ALL_OFF:
+        case ALL_ON:
+        case ALL_LAMPS_OFF:
+        case ALL_LAMPS_ON:
+            for (dev = 0; dev < 16; dev++)
+                record_unit(st, BR_UNIT(house, dev), cmd, now);
+            break;
+
+        default:
+            break;
+    }
+
+    return 0;
+}
+
+/*
+ * Where things will stand once a command list has gone out, worked out
+ *  from the store (if there is one) and the commands themselves
+ */
+
+typedef struct {
+    br_unit_state units[BR_NUM_UNITS];
+    int lastunit[16];
+} prediction;
+
+static void predict_init(br_state *st, prediction *p)
+{
+    register int i;
+
+
+    for (i = 0; i < BR_NUM_UNITS; i++) {
+        if (st)
+            br_state_get(st, i, &p->units[i]);
+        else {
+            memset(&p->units[i], 0, sizeof(br_unit_state));
+            p->units[i].level_hi = BR_STATE_FULL;
+        }
+    }
+
+    for (i = 0; i < 16; i++)
+        p->lastunit[i] = st ? LOAD(&st->map->lastunit[i]):0;
+}
+
+static void predict_cmd(prediction *p, int cmd, br_unit_list *units,
+  time_t now)
+{
+    int house;
+    int u;
+
+
+    if ((units == NULL) || (cmd == PAUSE))
+        return;
+
+    if (CMDHASDEVS(cmd)) {
+
+        /*
+         * Units go out in the list's order (see br_ul_next()), so the
+         *  last one addressed in each housecode is the last one there
+         */
+
+        for (u = br_ul_next(units, -1); u >= 0; u = br_ul_next(units, u)) {
+            apply(&p->units[u], cmd, now);
+            p->lastunit[BR_UNIT_HOUSE(u)] = u + 1;
+        }
+
+        return;
+    }
+
+    if ((house = br_get_ul_house(units, 0)) < 0)
+        return;
+
+    if (ISDIMCMD(cmd)) {
+        if (p->lastunit[house])
+            apply(&p->units[p->lastunit[house] - 1], cmd, now);
+
+        return;
+    }
+
+    for (u = BR_UNIT(house, 0); u <= BR_UNIT(house, 15); u++)
+        apply(&p->units[u], cmd, now);
+}
+
+int br_state_filter(br_state *st, br_control_info *cinfo, long max_age)
+{
+/*
+ * Drop ONs and OFFs that would leave a unit the way it was recorded
+ *  (or the way earlier commands in the list will leave it) less than
+ *  max_age seconds ago.  Lists that repeat or invert are left alone, as
+ *  are housecodes with dims in the list (a dim goes to the last unit
+ *  addressed, so every address counts).  Returns how many frames were
+ *  dropped.
+ */
+
+    prediction p;
+    br_unit_list *units;
+    time_t now = time(NULL);
+    int dimhouses = 0;
+    int dropped = 0;
+    int target;
+    int house;
+    int u;
+    register int i;
+    register int h;
+
+
+    if ((st == NULL) || (cinfo == NULL)) {
+        errno = EINVAL;
+        br_error("br_state_filter", "NULL pointer");
+        return -1;
+    }
+
+    if (cinfo->inverse || (cinfo->repeat != 1))
+        return 0;
+
+    for (i = 0; i < cinfo->numcmds; i++) {
+        if (ISDIMCMD(cinfo->cmds[i]) && cinfo->units[i]
+          && ((house = br_get_ul_house(cinfo->units[i], 0)) >= 0))
+            dimhouses |= 1 << house;
+    }
+
+    predict_init(st, &p);
+
+    for (i = 0; i < cinfo->numcmds; ) {
+        units = cinfo->units[i];
+
+        if (!CMDHASDEVS(cinfo->cmds[i])) {
+            predict_cmd(&p, cinfo->cmds[i], units, now);
+            i++;
+            continue;
+        }
+
+        target = (cinfo->cmds[i] == ON) ? BR_STATE_ON:BR_STATE_OFF;
+
+        for (u = br_us_next(&units->set, -1); u >= 0;
+          u = br_us_next(&units->set, u))
+        {
+            if (!(dimhouses & (1 << BR_UNIT_HOUSE(u)))
+              && (p.units[u].state == target)
+              && (now - p.units[u].when <= max_age))
+            {
+                br_us_del(&units->set, u);
+                dropped++;
+                continue;
+            }
+
+            apply(&p.units[u], cinfo->cmds[i], now);
+        }
+
+        units->numunits = br_us_count(&units->set);
+
+        /*
+         * Of what's left, whatever goes out last in each housecode is
+         *  what's been addressed
+         */
+
+        for (h = 0; h < 16; h++) {
+            if ((u = br_ul_last(units, h)) >= 0)
+                p.lastunit[h] = u + 1;
+        }
+
+        if (units->numunits == 0) {
+            if (br_del_cmd(cinfo, i) < 0)
+                return -1;
+
+            continue;
+        }
+
+        i++;
+    }
+
+    return dropped;
+}
+
+static int add_steps(br_control_info *cinfo, int house, int steps)
+{
+    int cmd = (steps < 0) ? DIM:BRIGHT;
+
+
+    if (steps < 0)
+        steps = -steps;
+
+    while (steps--) {
+        if (br_add_cmd(cinfo, cmd, house, 0) < 0)
+            return -1;
+    }
+
+    return 0;
+}
+
+int br_state_add_dim(br_state *st, br_control_info *cinfo, int house,
+  int dev, int level, int recalibrate)
+{
+/*
+ * Add what it takes to get a lamp to an absolute level, going by what
+ *  the store and the list so far say about it.  If it's already being
+ *  addressed and its level is known, that's just the difference in
+ *  steps; otherwise it gets an ON first.  If the level's not known (or
+ *  the caller doesn't trust it), the lamp's run to whichever end of the
+ *  range is closer and back down (or up) from there.
+ */
+
+    prediction p;
+    br_unit_state *u;
+    br_unit_state after;
+    time_t now = time(NULL);
+    int unit = BR_UNIT(house, dev);
+    int addressed;
+    register int i;
+
+
+    if ((cinfo == NULL) || (house < 0) || (house > 15) || (dev < 0)
+      || (dev > 15) || (level < 0) || (level > BR_STATE_FULL))
+    {
+        errno = EINVAL;
+        br_error("br_state_add_dim", "Bad unit or level");
+        return -1;
+    }
+
+    predict_init(st, &p);
+
+    for (i = 0; i < cinfo->numcmds; i++)
+        predict_cmd(&p, cinfo->cmds[i], cinfo->units[i], now);
+
+    u = &p.units[unit];
+    addressed = (u->state == BR_STATE_ON) && (p.lastunit[house] == unit + 1);
+
+    after = *u;
+    apply(&after, ON, now);
+
+    if (recalibrate) {
+        after.level_lo = 0;
+        after.level_hi = BR_STATE_FULL;
+    }
+
+    if (after.level_lo == after.level_hi) {
+        if ((u->state == BR_STATE_ON) && (level == after.level_lo))
+            return 0;
+
+        if ((!addressed && (br_add_cmd(cinfo, ON, house, dev) < 0))
+          || (add_steps(cinfo, house, level - after.level_lo) < 0))
+            return -1;
+
+        return 0;
+    }
+
+    if ((!addressed || recalibrate)
+      && (br_add_cmd(cinfo, ON, house, dev) < 0))
+        return -1;
+
+    if ((BR_STATE_FULL - after.level_lo) + (BR_STATE_FULL - level)
+      <= after.level_hi + level)
+    {
+        if ((add_steps(cinfo, house, BR_STATE_FULL - after.level_lo) < 0)
+          || (add_steps(cinfo, house, level - BR_STATE_FULL) < 0))
+            return -1;
+    } else {
+        if ((add_steps(cinfo, house, -after.level_hi) < 0)
+          || (add_steps(cinfo, house, level) < 0))
+            return -1;
+    }
+
+    return 0;
+}
+
+static void print_age(FILE *fp, long secs)
+{
+    if (secs < 120)
+        fprintf(fp, "%lds ago", secs);
+    else if (secs < 120 * 60)
+        fprintf(fp, "%ldm ago", secs / 60);
+    else if (secs < 48 * 3600)
+        fprintf(fp, "%ldh ago", secs / 3600);
+    else
+        fprintf(fp, "%ldd ago", secs / 86400);
+}
+
+int br_state_print(FILE *fp, br_state *st)
+{
+/*
+ * Every unit anything's been recorded for
+ */
+
+    br_unit_state us;
+    time_t now = time(NULL);
+    int u;
+
+
+    if (st == NULL) {
+        errno = EINVAL;
+        br_error("br_state_print", "NULL state pointer");
+        return -1;
+    }
+
+    fprintf(fp, "Unit  State    Level  Last set\n");
+
+    for (u = 0; u < BR_NUM_UNITS; u++) {
+        if ((br_state_get(st, u, &us) < 0) || (us.when == 0))
+            continue;
+
+        fprintf(fp, "%c%-4d %-8s ", HOUSENAME(BR_UNIT_HOUSE(u)),
+          BR_UNIT_DEV(u) + 1,
+          (us.state == BR_STATE_ON) ? "on":
+          (us.state == BR_STATE_OFF) ? "off":"unknown");
+
+        if (us.state != BR_STATE_ON)
+            fprintf(fp, "  -    ");
+        else if (us.level_lo == us.level_hi)
+            fprintf(fp, "%2d/%-2d  ", us.level_lo, BR_STATE_FULL);
+        else
+            fprintf(fp, "%2d-%-2d  ", us.level_lo, us.level_hi);
+
+        print_age(fp, (long)(now - us.when));
+        fprintf(fp, "\n");
+    }
+
+    return 0;
+}
+
+br_state *br_state_use(br_state *st)
+{
+    /*
+     * Returns the store that was in use before
+     */
+
+    br_state *old = current;
+
+
+    current = st;
+
+    return old;
+}
+
+void br_state_sent(int unit, int cmd)
+{
+    if (current && current->writable)
+        br_state_record(current, unit, cmd);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,109 @@
+#ifndef _BR_STATE_H
+#define _BR_STATE_H
+
+/*
+ * br_state.h -- What every unit was last told to do.  X10 through a
+ *               FireCracker only goes one way, so this is as close as
+ *               we get to knowing what's on: a small file, mapped into
+ *               every process sending commands, updated after each frame
+ *               goes out.
+ *
+ * (c) 1999 Tymm Twillman (tymm@acm.org)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "br_cmd_engine.h"
+
+/*
+ * Where the state lives if nobody says otherwise (can be overridden with
+ *  the BR_STATEFILE environment variable).  The directory should belong
+ *  to whoever runs brd; nobody else gets to write the file.
+ */
+
+#ifndef BR_STATEFILE
+#define BR_STATEFILE "/var/lib/br/br.state"
+#endif
+
+#define BR_STATE_MAGIC    0x42525354   /* "BRST" */
+#define BR_STATE_VERSION  2
+
+#define BR_STATE_UNKNOWN  0
+#define BR_STATE_ON       1
+#define BR_STATE_OFF      2
+
+#define BR_STATE_FULL     DIMRANGE     /* brightness of a unit that's just on */
+
+/*
+ * One unit's record.  seq is odd while someone's writing it; readers
+ *  try again until they get the same even number before and after.
+ *
+ * How bright a lamp is can only be worked out from what it's been sent,
+ *  so it's kept as a range: level_lo == level_hi once it's known (after
+ *  an ON from off, or enough BRIGHTs to be sure it's at the top).  It
+ *  only means anything while the unit's on.
+ */
+
+typedef struct {
+    uint32_t seq;
+    int32_t state;               /* BR_STATE_* */
+    int32_t level_lo;            /* brightness, 0 to BR_STATE_FULL */
+    int32_t level_hi;
+    int64_t when;                /* time() of the last command */
+} br_unit_state;
+
+/*
+ * The file itself
+ */
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t numunits;
+    int32_t lastunit[16];        /* per housecode, last unit addressed + 1
+                                  *  (dims go to it); 0 if none */
+    br_unit_state units[BR_NUM_UNITS];
+} br_state_file;
+
+typedef struct {
+    int fd;
+    int writable;
+    br_state_file *map;
+} br_state;
+
+br_state *br_state_open(char * /* path, NULL for the default */,
+              int /* writable? */);
+int br_state_close(br_state *);
+int br_state_get(br_state *, int /* unit */, br_unit_state *);
+int br_state_record(br_state *, int /* unit */, int /* cmd */);
+int br_state_filter(br_state *, br_control_info *, long /* max age, sec */);
+int br_state_add_dim(br_state * /* NULL if there's none */,
+              br_control_info *, int /* house */, int /* dev */,
+              int /* level, 0 to BR_STATE_FULL */, int /* recalibrate? */);
+int br_state_print(FILE *, br_state *);
+
+/*
+ * The store frames are recorded in as they go out (see br_send_frame());
+ *  NULL (the default) for none
+ */
+
+br_state *br_state_use(br_state *);
+void br_state_sent(int /* unit */, int /* cmd */);
+
+#endif
@@ -0,0 +1,125 @@
+/*
+ * br_stats.c -- Histograms for keeping track of how well BottleRocket is
+ *  keeping to its timing, and printing them out.
+ *  (c) 1999 by Tymm Twillman (tymm@acm.org).
+ *
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ */
+
+#ifdef __cplusplus
+extern C {
+#endif
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <string.h>
+
+#include "br_cmd.h"
+
+
+void br_hist_add(br_histogram *hist, long value)
+{
+    register int bucket = 0;
+    unsigned long mag;
+
+
+    if (hist->count == 0) {
+        hist->min = hist->max = value;
+    } else {
+        if (value < hist->min)
+            hist->min = value;
+        if (value > hist->max)
+            hist->max = value;
+    }
+
+    hist->count++;
+    hist->sum += value;
+
+    /*
+     * Bucket by order of magnitude
+     */
+
+    for (mag = (value < 0) ? -value:value; mag; mag >>= 1)
+        bucket++;
+
+    if (bucket >= BR_HIST_BUCKETS)
+        bucket = BR_HIST_BUCKETS - 1;
+
+    hist->buckets[bucket]++;
+}
+
+static void print_hist(FILE *fp, char *name, br_histogram *hist)
+{
+    register int i;
+    int col = 0;
+
+
+    if (hist->count == 0) {
+        fprintf(fp, "  %-12s %9lu\n", name, hist->count);
+        return;
+    }
+
+    fprintf(fp, "  %-12s %9lu %9ld %9.1f %9ld\n", name, hist->count,
+      hist->min, hist->sum / hist->count, hist->max);
+
+    for (i = 0; i < BR_HIST_BUCKETS; i++) {
+        if (!hist->buckets[i])
+            continue;
+
+        if (col == 0)
+            fprintf(fp, "               ");
+
+        if (i == 0)
+            fprintf(fp, "  <1:%lu", hist->buckets[i]);
+        else
+            fprintf(fp, "  <%lu:%lu", 1UL << i, hist->buckets[i]);
+
+        if (++col == 5) {
+            fprintf(fp, "\n");
+            col = 0;
+        }
+    }
+
+    if (col)
+        fprintf(fp, "\n");
+}
+
+void br_print_stats(FILE *fp, br_stats *stats)
+{
+    fprintf(fp, "Transmit statistics for %lu frames (uSec; histograms are "
+      "by magnitude):\n", stats->frames);
+    fprintf(fp, "  %-12s %9s %9s %9s %9s\n", "", "count", "min", "avg", "max");
+
+    print_hist(fp, "half-bit err", &stats->half_bit);
+    print_hist(fp, "pre late", &stats->pre_delay);
+    print_hist(fp, "post late", &stats->post_delay);
+    print_hist(fp, "gap late", &stats->gap);
+    print_hist(fp, "ioctl", &stats->ioctl);
+
+    fprintf(fp, "  %lu calls on the port (%.1f per frame), %lu of them "
+      "reading the lines\n", stats->line_calls,
+      stats->frames ? (double)stats->line_calls / stats->frames:0.0,
+      stats->line_reads);
+}
+
+#ifdef __cplusplus
+}
+#endif
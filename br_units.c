@@ -0,0 +1,236 @@
+/*
+ * br_units.c -- Unit sets: 256-bit bitmaps, one bit per X10 unit, with
+ *  the set operations done a 64-bit word at a time.
+ *  (c) 1999 by Tymm Twillman (tymm@acm.org).
+ *
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ */
+
+#ifdef __cplusplus
+extern C {
+#endif
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include "br_units.h"
+
+#define BIT(unit)   ((uint64_t)1 << ((unit) & 63))
+#define WORD(unit)  ((unit) >> 6)
+
+/*
+ * Bit counting and finding; the compiler's builtins where there are any
+ */
+
+#ifdef __GNUC__
+#define POPCOUNT(w)  __builtin_popcountll(w)
+#define LOWBIT(w)    __builtin_ctzll(w)
+#else
+static int POPCOUNT(uint64_t w)
+{
+    int n;
+
+
+    for (n = 0; w; n++)
+        w &= w - 1;
+
+    return n;
+}
+
+static int LOWBIT(uint64_t w)
+{
+    int n;
+
+
+    for (n = 0; !(w & 1); n++)
+        w >>= 1;
+
+    return n;
+}
+#endif
+
+
+void br_us_clear(br_unit_set *set)
+{
+    memset(set, 0, sizeof(br_unit_set));
+}
+
+int br_us_add(br_unit_set *set, int unit)
+{
+    int was = (set->words[WORD(unit)] & BIT(unit)) != 0;
+
+
+    set->words[WORD(unit)] |= BIT(unit);
+
+    return !was;
+}
+
+int br_us_del(br_unit_set *set, int unit)
+{
+    int was = (set->words[WORD(unit)] & BIT(unit)) != 0;
+
+
+    set->words[WORD(unit)] &= ~BIT(unit);
+
+    return was;
+}
+
+int br_us_test(const br_unit_set *set, int unit)
+{
+    return (set->words[WORD(unit)] & BIT(unit)) != 0;
+}
+
+int br_us_add_range(br_unit_set *set, int first, int last)
+{
+/*
+ * A housecode's units are all in one word, so a run of them is one mask
+ */
+
+    uint64_t mask;
+    int was;
+
+
+    mask = (~(uint64_t)0 >> (63 - (last - first))) << (first & 63);
+    was = POPCOUNT(set->words[WORD(first)] & mask);
+    set->words[WORD(first)] |= mask;
+
+    return (last - first + 1) - was;
+}
+
+int br_us_house_full(const br_unit_set *set, int house)
+{
+    uint64_t mask = (uint64_t)0xffff << ((house & 3) << 4);
+
+
+    return (set->words[WORD(BR_UNIT(house, 0))] & mask) == mask;
+}
+
+void br_us_union(br_unit_set *result, const br_unit_set *a,
+  const br_unit_set *b)
+{
+    register int i;
+
+
+    for (i = 0; i < BR_US_WORDS; i++)
+        result->words[i] = a->words[i] | b->words[i];
+}
+
+void br_us_intersect(br_unit_set *result, const br_unit_set *a,
+  const br_unit_set *b)
+{
+    register int i;
+
+
+    for (i = 0; i < BR_US_WORDS; i++)
+        result->words[i] = a->words[i] & b->words[i];
+}
+
+void br_us_diff(br_unit_set *result, const br_unit_set *a,
+  const br_unit_set *b)
+{
+    /*
+     * What's in a but not b
+     */
+
+    register int i;
+
+
+    for (i = 0; i < BR_US_WORDS; i++)
+        result->words[i] = a->words[i] & ~b->words[i];
+}
+
+int br_us_count(const br_unit_set *set)
+{
+    register int i;
+    int n = 0;
+
+
+    for (i = 0; i < BR_US_WORDS; i++)
+        n += POPCOUNT(set->words[i]);
+
+    return n;
+}
+
+int br_us_next(const br_unit_set *set, int after)
+{
+/*
+ * The first unit in the set past after, or -1 if there isn't one; start
+ *  with -1 to get the first
+ */
+
+    register int i;
+    uint64_t w;
+
+
+    if (++after >= BR_NUM_UNITS)
+        return -1;
+
+    if (after < 0)
+        after = 0;
+
+    i = WORD(after);
+    w = set->words[i] & (~(uint64_t)0 << (after & 63));
+
+    for (;;) {
+        if (w)
+            return (i << 6) + LOWBIT(w);
+
+        if (++i >= BR_US_WORDS)
+            return -1;
+
+        w = set->words[i];
+    }
+}
+
+int br_us_nth(const br_unit_set *set, int index)
+{
+/*
+ * The index'th unit in the set (from 0), or -1
+ */
+
+    register int i;
+    int n;
+    uint64_t w;
+
+
+    if (index < 0)
+        return -1;
+
+    for (i = 0; i < BR_US_WORDS; i++) {
+        w = set->words[i];
+
+        if ((n = POPCOUNT(w)) <= index) {
+            index -= n;
+            continue;
+        }
+
+        while (index--)
+            w &= w - 1;     /* drop the lowest bit */
+
+        return (i << 6) + LOWBIT(w);
+    }
+
+    return -1;
+}
+
+#ifdef __cplusplus
+}
+#endif
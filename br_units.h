@@ -0,0 +1,62 @@
+#ifndef _BR_UNITS_H
+#define _BR_UNITS_H
+
+/*
+ * br_units.h -- Sets of X10 units.  There are only 16 x 16 = 256 of
+ *               them, so a set is a 256-bit bitmap; unit numbers are
+ *               housecode << 4 | device, same as in a frame.
+ *
+ * (c) 1999 Tymm Twillman (tymm@acm.org)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <stdint.h>
+
+#define BR_NUM_UNITS   256
+#define BR_US_WORDS    (BR_NUM_UNITS / 64)
+
+#define BR_UNIT(house, dev)   ((((house) & 0x0f) << 4) | ((dev) & 0x0f))
+#define BR_UNIT_HOUSE(unit)   (((unit) >> 4) & 0x0f)
+#define BR_UNIT_DEV(unit)     ((unit) & 0x0f)
+
+typedef struct {
+    uint64_t words[BR_US_WORDS];
+} br_unit_set;
+
+/*
+ * Units in a set come out in order: A1, A2, ... A16, B1, ...
+ *  (housecode numbers, that is; see housecode_table for what they send)
+ */
+
+void br_us_clear(br_unit_set *);
+int br_us_add(br_unit_set *, int /* unit */);       /* 1 if it was new */
+int br_us_del(br_unit_set *, int /* unit */);       /* 1 if it was there */
+int br_us_test(const br_unit_set *, int /* unit */);
+int br_us_add_range(br_unit_set *, int /* first unit */,
+              int /* last unit, same housecode */);   /* how many were new */
+int br_us_house_full(const br_unit_set *, int /* house */);
+void br_us_union(br_unit_set * /* result */, const br_unit_set *,
+              const br_unit_set *);
+void br_us_intersect(br_unit_set * /* result */, const br_unit_set *,
+              const br_unit_set *);
+void br_us_diff(br_unit_set * /* result */, const br_unit_set *,
+              const br_unit_set *);
+int br_us_count(const br_unit_set *);
+int br_us_next(const br_unit_set *, int /* after this unit, -1 to start */);
+int br_us_nth(const br_unit_set *, int /* index */);
+
+#endif
@@ -0,0 +1,1055 @@
+/*
+ *
+ * brd (BottleRocket daemon)
+ *
+ * Keeps the FireCracker's serial port open and transmits commands handed
+ * to it by br (or anything else using br_send_control_info()) one list at
+ * a time, in the order they arrived.  Since only one thread ever touches
+ * the port, commands from different clients can't step on each other's
+ * frames.  With several FireCrackers on several ports, each port gets its
+ * own thread, and each list is split up by which port its units are on.
+ *
+ * (c) 1999 Tymm Twillman (tymm@acm.org)
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU General Public License
+ *   as published by the Free Software Foundation; either version 2
+ *   of the License, or (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ */
+
+#define VERSION "0.05b3"
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <unistd.h>
+#include <stdio.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/time.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <signal.h>
+#include <syslog.h>
+#include <poll.h>
+#include <time.h>
+#include <pthread.h>
+
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#endif
+
+#ifdef HAVE_GETOPT_LONG
+#include <getopt.h>
+#endif
+
+#include "br.h"
+#include "br_cmd.h"
+#include "br_cmd_engine.h"
+#include "br_ipc.h"
+#include "br_async.h"
+#include "br_state.h"
+#include "br_sched.h"
+#include "br_profile.h"
+
+#define CLIENT_TIMEOUT 5     /* seconds a client gets to send its commands */
+#define MAX_CLIENTS    32    /* being read from at once */
+
+int Verbose = 0;
+int Detached = 0;
+int RealTime = 0;
+int Cpu = -1;
+char *MyName;
+void (*saved_br_error_handler)(char *, char *);
+
+static volatile sig_atomic_t Quit = 0;
+static volatile sig_atomic_t Report = 0;
+
+static br_engine *Engine;
+static br_sched *Sched = NULL;
+
+static pthread_mutex_t ClientLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t ClientGone = PTHREAD_COND_INITIALIZER;
+static int Clients = 0;
+
+void usage()
+{
+    fprintf(stderr, "BottleRocket daemon version %s\n", VERSION);
+    fprintf(stderr, "\n");
+    fprintf(stderr, "Usage: %s [<options>]\n\n", MyName);
+    fprintf(stderr, "  Options:\n");
+#ifdef HAVE_GETOPT_LONG
+    fprintf(stderr, "  -v, --verbose\t\t\tadd v's to increase verbosity\n");
+    fprintf(stderr, "  -x, --port=PORT\t\tset port to use (again to add "
+      "more)\n");
+    fprintf(stderr, "  -m, --map=UNITS:NUM\t\tsend UNITS (\"B\" or "
+      "\"A1,2\") out port NUM\n");
+    fprintf(stderr, "  -s, --socket=PATH\t\tlisten for commands on PATH "
+      "(default \"%s\")\n", BRD_SOCKNAME);
+    fprintf(stderr, "  -F, --foreground\t\tdon't detach from the terminal\n");
+    fprintf(stderr, "  -g, --gap=USEC\t\tgap between back-to-back "
+      "commands\n");
+    fprintf(stderr, "  -L, --profile=NAME\t\tuse the timing saved in "
+      "profile NAME\n");
+    fprintf(stderr, "  -R, --realtime\t\tuse real-time priority while "
+      "sending\n");
+    fprintf(stderr, "  -C, --cpu=NUM\t\t\tin real-time mode, send from "
+      "CPU NUM\n");
+    fprintf(stderr, "  -e, --schedule=FILE\t\tsend the commands in FILE "
+      "when they're due\n");
+    fprintf(stderr, "  -h, --help\t\t\tthis help\n\n");
+#else
+    fprintf(stderr, "  -v\tverbose (add v's to increase verbosity)\n");
+    fprintf(stderr, "  -x\tset port to use (again to add more)\n");
+    fprintf(stderr, "  -m\tUNITS:NUM sends UNITS (\"B\" or \"A1,2\") out "
+      "port NUM\n");
+    fprintf(stderr, "  -s\tlisten for commands on this socket (default \"%s\")\n",
+      BRD_SOCKNAME);
+    fprintf(stderr, "  -F\tdon't detach from the terminal\n");
+    fprintf(stderr, "  -g\tgap in uSec between back-to-back commands\n");
+    fprintf(stderr, "  -L\tuse the timing saved in profile <name>\n");
+    fprintf(stderr, "  -R\tuse real-time priority while sending\n");
+    fprintf(stderr, "  -C\tin real-time mode, send from this CPU\n");
+    fprintf(stderr, "  -e\tsend the commands in this file when they're due\n");
+    fprintf(stderr, "  -h\tthis help\n\n");
+#endif
+}
+
+void my_br_error_handler(char *where, char *problem)
+{
+    int tmperrno = errno;
+    char *tmpwhere;
+
+
+    tmpwhere = (Verbose ? where:NULL);
+
+    /*
+     * Once we've let go of the terminal, nobody's going to see stderr
+     */
+
+    if (Detached) {
+        syslog(LOG_ERR, "%s%s%s%s%s",
+          problem ? problem:"(unknown error)",
+          tmpwhere ? " in ":"", tmpwhere ? tmpwhere:"",
+          tmperrno ? ": ":"", tmperrno ? strerror(tmperrno):"");
+        errno = tmperrno;
+        return;
+    }
+
+    fprintf(stderr, "%s: ", MyName);
+
+    errno = tmperrno;
+
+    (*saved_br_error_handler)(tmpwhere, problem);
+}
+
+int checkimmutableport(char *port_source)
+{
+/*
+ * Check to see if the user is allowed to specify an alternate serial port
+ */
+
+    if (!ISSETID())
+        return 0;
+
+    errno = EPERM;
+    br_error("checkimmutableport", "You are not authorized to change the X10 port!");
+    fprintf(stderr, "\tPort specified %s\n", port_source);
+
+    return -1;
+}
+
+int open_port(char *port)
+{
+/*
+ * Open the serial port that a FireCracker device is (we expect) on
+ */
+    int fd;
+
+
+    if (Verbose >= 2)
+        printf("%s: Opening serial port %s.\n", MyName, port);
+
+    if ((fd = open(port, O_RDONLY | O_NONBLOCK)) < 0) {
+        br_error("open_port", "Unable to open serial port");
+        return -1;
+    }
+
+    if (!SAFE_FILENO(fd)) {
+        close(fd);
+        errno = EBADF;
+        return -1;
+    }
+
+    return fd;
+}
+
+int realtime(int cpu)
+{
+/*
+ * Turn on real-time mode, and tell the user if it didn't all happen
+ */
+
+    int granted;
+
+
+    granted = br_rt_enable(cpu, 0);
+
+    if (!(granted & BR_RT_SCHED) || ((cpu >= 0) && !(granted & BR_RT_AFFINITY))) {
+        if (Detached)
+            syslog(LOG_WARNING, "real-time mode only partly available "
+              "(need root or CAP_SYS_NICE)");
+        else
+            fprintf(stderr, "%s: warning: real-time mode only partly "
+              "available (need root or CAP_SYS_NICE)\n", MyName);
+    }
+
+    if (Verbose >= 1)
+        printf("%s: Real-time scheduling %s, memory %s, %s\n", MyName,
+          (granted & BR_RT_SCHED) ? "on":"off",
+          (granted & BR_RT_MLOCK) ? "locked":"not locked",
+          (granted & BR_RT_AFFINITY) ? "pinned to CPU":"not pinned");
+
+    return granted;
+}
+
+static void quit_handler(int sig)
+{
+    Quit = 1;
+}
+
+static void report_handler(int sig)
+{
+    Report = 1;
+}
+
+static void rt_setup(int port, void *arg)
+{
+    /*
+     * CPU pinning and scheduling are per-thread, so this has to happen
+     *  on the engine's transmit threads rather than in main().  Ports
+     *  after the first get the CPUs after the one asked for, so they
+     *  don't get in each other's way.
+     */
+
+    realtime((Cpu >= 0) ? Cpu + port:-1);
+}
+
+static int add_route(char *map)
+{
+/*
+ * UNITS:NUM -- a housecode ("B") or list of units ("A1,2,5") and which
+ *  port they're on, counting -x options from 0
+ */
+
+    br_unit_list *units;
+    char *colon;
+    char *end;
+    int house;
+    int port;
+    int u;
+    int rv = 0;
+
+
+    if (((colon = strrchr(map, ':')) == NULL) || !isdigit(colon[1])) {
+        errno = EINVAL;
+        br_error(NULL, "Invalid port map (should be UNITS:NUM)");
+        return -1;
+    }
+
+    port = atoi(colon + 1);
+    *colon = '\0';
+
+    house = br_strtohc(map, &end);
+
+    if ((house >= 0) && (*end == '\0'))
+        return br_engine_route_house(Engine, house, port);
+
+    if ((units = br_new_unit_list()) == NULL)
+        return -1;
+
+    if (br_strtoul(map, units, &end) < 0) {
+        br_free_unit_list(units);
+        return -1;
+    }
+
+    if (*end) {
+        errno = EINVAL;
+        br_error(NULL, "Invalid unit list in port map");
+        br_free_unit_list(units);
+        return -1;
+    }
+
+    for (u = br_us_next(&units->set, -1); (u >= 0) && (rv == 0);
+      u = br_us_next(&units->set, u))
+        rv = br_engine_route(Engine, u, port);
+
+    br_free_unit_list(units);
+
+    return rv;
+}
+
+static void job_done(br_request *req, void *arg)
+{
+/*
+ * Runs on the engine's thread once a client's commands have gone out:
+ *  let the client know how it went.
+ */
+
+    int client = (int)(long)arg;
+
+
+    /*
+     * The client may have given up waiting; that's its business
+     */
+
+    br_send_status(client, (req->status == BR_REQ_DONE) ? 0:-1, req->error);
+    close(client);
+
+    br_free_request(req);
+}
+
+/*
+ * Commands for the schedule, by their native br names
+ */
+
+static struct {
+    char *name;
+    int cmd;
+} sched_cmds[] = {
+    {"ON",         ON},
+    {"OFF",        OFF},
+    {"DIM",        DIM},
+    {"BRIGHT",     BRIGHT},
+    {"ALL_ON",     ALL_ON},
+    {"ALL_OFF",    ALL_OFF},
+    {"LAMPS_ON",   ALL_LAMPS_ON},
+    {"LAMPS_OFF",  ALL_LAMPS_OFF},
+    {NULL,         0}
+};
+
+static char *next_word(char **p)
+{
+    char *word;
+
+
+    while (isspace(**p))
+        (*p)++;
+
+    if (**p == '\0')
+        return NULL;
+
+    word = *p;
+
+    while (**p && !isspace(**p))
+        (*p)++;
+
+    if (**p)
+        *(*p)++ = '\0';
+
+    return word;
+}
+
+static int sched_parse_cmds(br_control_info *cinfo, char *p)
+{
+/*
+ * Native br commands: "A1,3 ON B DIM ..."
+ */
+
+    br_unit_list *units;
+    char *where;
+    char *what;
+    char *end;
+    int house;
+    register int i;
+
+
+    while ((where = next_word(&p))) {
+        if ((what = next_word(&p)) == NULL)
+            goto bad;
+
+        for (i = 0; sched_cmds[i].name; i++) {
+            if (!strcasecmp(what, sched_cmds[i].name))
+                break;
+        }
+
+        if (sched_cmds[i].name == NULL)
+            goto bad;
+
+        if (CMDHASDEVS(sched_cmds[i].cmd)) {
+            if ((units = br_new_cmd_unit_list(cinfo)) == NULL)
+                return -1;
+
+            if (br_strtoul(where, units, &end) < 0)
+                return -1;
+
+            if (*end)
+                goto bad;
+
+            if (br_add_ul_cmd_grouped(cinfo, sched_cmds[i].cmd, units) < 0)
+                return -1;
+        } else {
+            if (((house = br_strtohc(where, &end)) < 0) || *end)
+                goto bad;
+
+            if (br_add_cmd(cinfo, sched_cmds[i].cmd, house, 0) < 0)
+                return -1;
+        }
+    }
+
+    if (br_get_num_commands(cinfo))
+        return 0;
+
+bad:
+    errno = EINVAL;
+    br_error(NULL, "Bad commands (should be native br commands, "
+      "like \"A1,3 ON B DIM\")");
+
+    return -1;
+}
+
+static int sched_parse_time(char *str, struct tm *tm)
+{
+    int secs = 0;
+    char c;
+
+
+    if ((sscanf(str, "%d:%d%c", &tm->tm_hour, &tm->tm_min, &c) != 2)
+      && ((sscanf(str, "%d:%d:%d%c", &tm->tm_hour, &tm->tm_min, &secs, &c)
+        != 3) || (secs < 0) || (secs > 59)))
+        return -1;
+
+    tm->tm_sec = secs;
+
+    if ((tm->tm_hour < 0) || (tm->tm_hour > 23) || (tm->tm_min < 0)
+      || (tm->tm_min > 59))
+        return -1;
+
+    return 0;
+}
+
+static int sched_add(char *line, time_t now)
+{
+/*
+ * One line of the schedule:
+ *
+ *   at [YYYY-MM-DD] HH:MM[:SS] <commands>   once (next time it's HH:MM,
+ *                                           without the date)
+ *   every N[s|m|h|d] <commands>             every N, on multiples of N
+ *   cron MIN HOUR MDAY MONTH WDAY <commands>
+ */
+
+    br_control_info *cinfo;
+    br_calendar cal;
+    struct tm tm;
+    char *p = line;
+    char *kind;
+    char *word;
+    char c;
+    int dated = 0;
+    long secs = 0;
+    time_t when = 0;
+
+
+    if (((kind = next_word(&p)) == NULL) || (*kind == '#'))
+        return 0;
+
+    if (!strcasecmp(kind, "at")) {
+        localtime_r(&now, &tm);
+
+        if ((word = next_word(&p)) == NULL)
+            goto bad;
+
+        if (strchr(word, '-')) {
+            if ((sscanf(word, "%d-%d-%d%c", &tm.tm_year, &tm.tm_mon,
+              &tm.tm_mday, &c) != 3) || ((word = next_word(&p)) == NULL))
+                goto bad;
+
+            tm.tm_year -= 1900;
+            tm.tm_mon--;
+            dated = 1;
+        }
+
+        if (sched_parse_time(word, &tm) < 0)
+            goto bad;
+
+        tm.tm_isdst = -1;
+
+        if ((when = mktime(&tm)) == (time_t)-1)
+            goto bad;
+
+        if ((when <= now) && !dated) {
+            tm.tm_mday++;
+            tm.tm_isdst = -1;
+            when = mktime(&tm);
+        }
+    } else if (!strcasecmp(kind, "every")) {
+        if (((word = next_word(&p)) == NULL)
+          || ((secs = strtol(word, &word, 10)) <= 0))
+            goto bad;
+
+        switch (*word) {
+            case 'd':
+                secs *= 24;
+                /* FALLTHROUGH */
+            case 'h':
+                secs *= 60;
+                /* FALLTHROUGH */
+            case 'm':
+                secs *= 60;
+                /* FALLTHROUGH */
+            case 's':
+                word++;
+                /* FALLTHROUGH */
+            case '\0':
+                break;
+            default:
+                goto bad;
+        }
+
+        if (*word)
+            goto bad;
+
+        when = now - (now % secs) + secs;
+    } else if (!strcasecmp(kind, "cron")) {
+        if (br_strtocal(p, &cal, &p) < 0)
+            return -1;
+    } else {
+        goto bad;
+    }
+
+    if ((cinfo = br_new_control_info()) == NULL)
+        return -1;
+
+    if (sched_parse_cmds(cinfo, p) < 0) {
+        br_free_control_info(cinfo);
+        return -1;
+    }
+
+    if (((*kind == 'a') || (*kind == 'A'))
+      ? (br_sched_at(Sched, when, cinfo) == NULL)
+      : ((*kind == 'e') || (*kind == 'E'))
+      ? (br_sched_every(Sched, when, secs, cinfo) == NULL)
+      : (br_sched_calendar(Sched, &cal, cinfo) == NULL))
+    {
+        br_free_control_info(cinfo);
+        return -1;
+    }
+
+    return 0;
+
+bad:
+    errno = EINVAL;
+    br_error(NULL, "Bad time (should be \"at [YYYY-MM-DD] HH:MM[:SS]\", "
+      "\"every N[smhd]\" or \"cron MIN HOUR MDAY MONTH WDAY\")");
+
+    return -1;
+}
+
+static int load_schedule(char *path)
+{
+    FILE *fp;
+    char line[1024];
+    char msg[80];
+    int lineno = 0;
+    time_t now = time(NULL);
+
+
+    if ((fp = fopen(path, "r")) == NULL) {
+        br_error(NULL, "Unable to open schedule");
+        return -1;
+    }
+
+    if ((Sched == NULL) && ((Sched = br_new_sched(now)) == NULL)) {
+        fclose(fp);
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), fp)) {
+        lineno++;
+
+        if (sched_add(line, now) < 0) {
+            sprintf(msg, "%.40s, line %d: Not scheduled", path, lineno);
+            br_error(NULL, msg);
+            fclose(fp);
+            errno = EINVAL;
+            return -1;
+        }
+    }
+
+    fclose(fp);
+
+    if (Verbose >= 1)
+        printf("%s: %d events scheduled\n", MyName, Sched->stats.pending);
+
+    return 0;
+}
+
+static void sched_done(br_request *req, void *arg)
+{
+    if (req->status == BR_REQ_FAILED) {
+        errno = req->error;
+        br_error(NULL, "Scheduled commands didn't go out");
+    }
+
+    br_free_request(req);
+}
+
+static void sched_fire(br_control_info *batch, void *arg)
+{
+    if (Verbose >= 2)
+        printf("%s: Sending %d scheduled commands\n", MyName,
+          br_get_num_commands(batch));
+
+    if (br_submit(Engine, batch, sched_done, NULL) == NULL)
+        br_free_control_info(batch);
+}
+
+static void report_sched()
+{
+/*
+ * How far behind the schedule's been running
+ */
+
+    br_sched_stats stats;
+    char msg[160];
+
+
+    if ((Sched == NULL) || (br_sched_get_stats(Sched, &stats) < 0))
+        return;
+
+    sprintf(msg, "schedule: %d events waiting, %lu fired in %lu batches; "
+      "lateness %ld ms last, %.1f ms average, %ld ms worst",
+      stats.pending, stats.fired, stats.batches, stats.late_last,
+      stats.fired ? stats.late_total / stats.fired:0.0, stats.late_max);
+
+    if (Detached)
+        syslog(LOG_INFO, "%s", msg);
+    else
+        printf("%s: %s\n", MyName, msg);
+}
+
+static int detach()
+{
+    int fd;
+
+
+    switch (fork()) {
+        case -1:
+            br_error("detach", "fork");
+            return -1;
+        case 0:
+            break;
+        default:
+            exit(0);
+    }
+
+    setsid();
+    chdir("/");
+
+    if ((fd = open("/dev/null", O_RDWR)) >= 0) {
+        dup2(fd, STDIN_FILENO);
+        dup2(fd, STDOUT_FILENO);
+        dup2(fd, STDERR_FILENO);
+
+        if (fd > STDERR_FILENO)
+            close(fd);
+    }
+
+    openlog("brd", LOG_PID, LOG_DAEMON);
+    Detached = 1;
+
+    return 0;
+}
+
+static void *take_client(void *arg)
+{
+/*
+ * Read a client's command list and queue it up.  Each client gets a
+ *  thread of its own for this, so one that's slow to send only holds
+ *  itself up, not other clients or the schedule; the timeout keeps a
+ *  stuck one from hanging around forever.
+ */
+
+    int client = (int)(long)arg;
+    struct timeval timeout;
+    br_control_info *cinfo;
+
+
+    timeout.tv_sec = CLIENT_TIMEOUT;
+    timeout.tv_usec = 0;
+
+    setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    if ((cinfo = br_recv_control_info(client)) == NULL) {
+        br_send_status(client, -1, errno);
+        close(client);
+    } else {
+        if (Verbose >= 2)
+            printf("%s: Queueing %d commands\n", MyName,
+              br_get_num_commands(cinfo));
+
+        if (br_submit(Engine, cinfo, job_done, (void *)(long)client) == NULL) {
+            br_send_status(client, -1, errno);
+            close(client);
+            br_free_control_info(cinfo);
+        }
+    }
+
+    pthread_mutex_lock(&ClientLock);
+    Clients--;
+    pthread_cond_signal(&ClientGone);
+    pthread_mutex_unlock(&ClientLock);
+
+    return NULL;
+}
+
+static int start_client(int client)
+{
+/*
+ * Hand a new connection off to a thread of its own.  Signals are left to
+ *  the main thread, so they still get poll() out of its wait.
+ */
+
+    pthread_attr_t attr;
+    pthread_t thread;
+    sigset_t all, old;
+    int busy;
+
+
+    pthread_mutex_lock(&ClientLock);
+
+    if ((busy = (Clients >= MAX_CLIENTS)) == 0)
+        Clients++;
+
+    pthread_mutex_unlock(&ClientLock);
+
+    if (busy) {
+        errno = EAGAIN;
+        br_error("serve", "Too many clients at once");
+        return -1;
+    }
+
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &old);
+
+    errno = pthread_create(&thread, &attr, take_client, (void *)(long)client);
+
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+    pthread_attr_destroy(&attr);
+
+    if (errno) {
+        br_error("serve", "pthread_create");
+
+        pthread_mutex_lock(&ClientLock);
+        Clients--;
+        pthread_mutex_unlock(&ClientLock);
+
+        return -1;
+    }
+
+    return 0;
+}
+
+static void serve(int listen_sock)
+{
+/*
+ * Take in command lists from clients (see take_client()) and keep the
+ *  schedule going.  Before going, wait for any clients still being read
+ *  from, so nothing's handed to the engine after it's stopped.
+ */
+
+    struct timespec now;
+    struct pollfd pfd;
+    int wait = -1;
+    int client;
+    int rv;
+
+
+    while (!Quit) {
+
+        /*
+         * With a schedule, wake up at the top of every second to see
+         *  what's due
+         */
+
+        if (Sched) {
+            clock_gettime(CLOCK_REALTIME, &now);
+            br_sched_run(Sched, &now, sched_fire, NULL);
+            wait = 1000 - now.tv_nsec / 1000000;
+        }
+
+        if (Report) {
+            Report = 0;
+            report_sched();
+        }
+
+        pfd.fd = listen_sock;
+        pfd.events = POLLIN;
+
+        if ((rv = poll(&pfd, 1, wait)) <= 0) {
+            if ((rv < 0) && (errno != EINTR))
+                br_error("serve", "poll");
+            continue;
+        }
+
+        if ((client = accept(listen_sock, NULL, NULL)) < 0) {
+            if (errno != EINTR)
+                br_error("serve", "accept");
+            continue;
+        }
+
+        if (start_client(client) < 0) {
+            br_send_status(client, -1, errno);
+            close(client);
+        }
+    }
+
+    pthread_mutex_lock(&ClientLock);
+
+    while (Clients)
+        pthread_cond_wait(&ClientGone, &ClientLock);
+
+    pthread_mutex_unlock(&ClientLock);
+}
+
+int main(int argc, char **argv)
+{
+    char *port_source = "at compile time";
+    char *tmp_port;
+    char *ports[BR_MAX_PORTS];
+    int numports = 0;
+    char *maps[BR_NUM_UNITS];
+    int nummaps = 0;
+    int fds[BR_MAX_PORTS];
+    char *sockname = BRD_SOCKNAME;
+    int foreground = 0;
+    int opt;
+    register int i;
+    int listen_sock;
+    struct sigaction sa;
+    br_state *state;
+    char *schedule = NULL;
+
+#ifdef HAVE_GETOPT_LONG
+    int opt_index;
+    static struct option long_options[] = {
+        {"help",       no_argument,            0, 'h'},
+        {"port",       required_argument,      0, 'x'},
+        {"map",        required_argument,      0, 'm'},
+        {"socket",     required_argument,      0, 's'},
+        {"foreground", no_argument,            0, 'F'},
+        {"verbose",    no_argument,            0, 'v'},
+        {"gap",        required_argument,      0, 'g'},
+        {"realtime",   no_argument,            0, 'R'},
+        {"cpu",        required_argument,      0, 'C'},
+        {"schedule",   required_argument,      0, 'e'},
+        {"profile",    required_argument,      0, 'L'},
+        {0, 0, 0, 0}
+    };
+#endif
+
+#define OPT_STRING     "x:m:s:Fhvg:RC:e:L:"
+
+    saved_br_error_handler = br_error_handler;
+    br_error_handler = my_br_error_handler;
+
+    MyName = argv[0];
+
+    ports[0] = X10_PORTNAME;
+
+    if ((tmp_port = getenv("X10_PORTNAME"))) {
+        port_source = "in the environment variable X10_PORTNAME";
+
+        if (checkimmutableport(port_source)) {
+            exit(errno);
+        } else {
+            ports[0] = tmp_port;
+        }
+    }
+
+    if (getenv("BRD_SOCKNAME"))
+        sockname = getenv("BRD_SOCKNAME");
+
+#ifdef HAVE_GETOPT_LONG
+    while ((opt = getopt_long(argc, argv, OPT_STRING, long_options,
+      &opt_index)) != -1)
+    {
+#else
+    while ((opt = getopt(argc, argv, OPT_STRING)) != -1) {
+#endif
+        switch (opt) {
+            case 'x':                                  /* Set the port */
+                port_source = "on the command line";
+                if (checkimmutableport(port_source) < 0)
+                    exit(errno);
+
+                /*
+                 * The first one replaces the default; the rest are extra
+                 */
+
+                if (numports >= BR_MAX_PORTS) {
+                    errno = ENOSPC;
+                    br_error(NULL, "Too many ports");
+                    exit(errno);
+                }
+
+                ports[numports++] = optarg;
+                break;
+            case 'm':                                  /* Unit to port map */
+                if (nummaps >= BR_NUM_UNITS) {
+                    errno = ENOSPC;
+                    br_error(NULL, "Too many port maps");
+                    exit(errno);
+                }
+
+                maps[nummaps++] = optarg;
+                break;
+            case 's':                                  /* Set the socket */
+                sockname = optarg;
+                break;
+            case 'e':                                  /* Timed commands */
+                schedule = optarg;
+                break;
+            case 'F':                                  /* Stay in front */
+                foreground = 1;
+                break;
+            case 'R':                                  /* Real-time */
+                RealTime = 1;
+                break;
+            case 'C':                                  /* CPU for real-time */
+                Cpu = atoi(optarg);
+                if ((Cpu < 0) || (!Cpu && !isdigit(*optarg))) {
+                    errno = EINVAL;
+                    br_error(NULL, "Invalid CPU number");
+                    exit(errno);
+                }
+                break;
+            case 'L':                                  /* Timing profile */
+                if (br_profile_load(optarg, &br_default_context) < 0)
+                    exit(errno);
+                break;
+            case 'g':                                  /* Inter-frame gap */
+                br_inter_frame_delay = atoi(optarg);
+                if ((br_inter_frame_delay < 0)
+                  || (!br_inter_frame_delay && !isdigit(*optarg)))
+                {
+                    errno = EINVAL;
+                    br_error(NULL, "Invalid gap value");
+                    exit(errno);
+                }
+                break;
+            case 'v':                                  /* Verbose */
+                Verbose++;
+                if (Verbose >= 4)
+                    br_verbose = Verbose - 3;
+                break;
+            case 'h':                                  /* Help */
+                usage();
+                exit(0);
+            default:
+                usage();
+                exit(EINVAL);
+        }
+    }
+
+    if (argc > optind) {
+        usage();
+        exit(EINVAL);
+    }
+
+    if (numports == 0)
+        numports = 1;
+
+    if ((Engine = br_new_engine()) == NULL)
+        exit(errno);
+
+    for (i = 0; i < numports; i++) {
+        if (((fds[i] = open_port(ports[i])) < 0)
+          || (br_engine_add_port(Engine, fds[i], NULL) < 0))
+            exit(errno);
+    }
+
+    for (i = 0; i < nummaps; i++) {
+        if (add_route(maps[i]) < 0)
+            exit(errno);
+    }
+
+    /*
+     * So br --status and br --suppress know what we've been sending
+     */
+
+    if ((state = br_state_open(NULL, 1)))
+        br_state_use(state);
+
+    if (schedule && (load_schedule(schedule) < 0))
+        exit(errno);
+
+    if ((listen_sock = br_daemon_listen(sockname)) < 0)
+        exit(errno);
+
+    if (!foreground && (detach() < 0))
+        exit(errno);
+
+    /*
+     * No SA_RESTART, so accept() comes back to us when it's time to go
+     */
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = quit_handler;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGTERM, &sa, NULL);
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGHUP, &sa, NULL);
+
+    sa.sa_handler = report_handler;
+    sigaction(SIGUSR1, &sa, NULL);
+
+    sa.sa_handler = SIG_IGN;
+    sigaction(SIGPIPE, &sa, NULL);
+
+    if (br_engine_run(Engine, RealTime ? rt_setup:NULL, NULL) < 0) {
+        unlink(sockname);
+        exit(errno);
+    }
+
+    if (Verbose >= 1)
+        printf("%s: Listening on %s\n", MyName, sockname);
+
+    serve(listen_sock);
+
+    if (Verbose >= 1)
+        printf("%s: Shutting down\n", MyName);
+
+    close(listen_sock);
+    unlink(sockname);
+    br_engine_stop(Engine);
+
+    if (Verbose >= 1)
+        report_sched();
+
+    br_free_sched(Sched);
+    br_state_close(state);
+
+    for (i = 0; i < numports; i++)
+        close(fds[i]);
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+/*
+ * mkframes.c -- Generates br_frames.c, the table of every frame the
+ *  FireCracker can be sent (16 housecodes x 16 devices x each command),
+ *  so encoding a command at run time is just a table lookup.
+ *  (c) 1999 by Tymm Twillman (tymm@acm.org).
+ *
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU General Public License
+ *   as published by the Free Software Foundation; either version 2
+ *   of the License, or (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ */
+
+#include <stdio.h>
+
+#include "br_cmd.h"
+#include "br_translate.h"
+
+int main()
+{
+    int house;
+    int dev;
+    int cmd;
+    unsigned char cmd_seq[5];
+
+
+    printf("/*\n * br_frames.c -- generated by mkframes from br_translate.h;"
+      " don't edit.\n */\n\n");
+    printf("#include \"br_plan.h\"\n\n");
+    printf("const unsigned char br_frame_table[16][16][%d][BR_FRAME_LEN] = {\n",
+      MAX_CMD + 1);
+
+    for (house = 0; house <= MAX_housecode; house++) {
+        printf("  { /* %c */\n", HOUSENAME(house));
+
+        for (dev = 0; dev <= MAX_DEVICE; dev++) {
+            printf("    { ");
+
+            for (cmd = 0; cmd <= MAX_CMD; cmd++) {
+
+                /*
+                 * Same thing br_cmd() always did, just done ahead of time
+                 */
+
+                cmd_seq[0] = 0xd5;
+                cmd_seq[1] = 0xaa;
+                cmd_seq[2] = housecode_table[house] << 4 | device_table[dev][0];
+                cmd_seq[3] = device_table[dev][1] | cmd_table[cmd];
+                cmd_seq[4] = 0xad;
+
+                printf("{0x%02x,0x%02x,0x%02x,0x%02x,0x%02x}%s",
+                  cmd_seq[0], cmd_seq[1], cmd_seq[2], cmd_seq[3], cmd_seq[4],
+                  (cmd < MAX_CMD) ? ",":"");
+            }
+
+            printf(" }%s\n", (dev < MAX_DEVICE) ? ",":"");
+        }
+
+        printf("  }%s\n", (house < MAX_housecode) ? ",":"");
+    }
+
+    printf("};\n");
+
+    return 0;
+}